@@ -0,0 +1,237 @@
+﻿using System;
+using System.Diagnostics;
+using System.IO;
+using System.Threading;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Playing a large animated GIF in real time at 60 fps for one second, either
+// decoding each due frame from scratch on the UI thread or with a player
+// that decodes ahead in the background. Every operation takes about one
+// second, so the interesting numbers are the dropped frames and the CPU time
+// per second of playback that are written out at the end.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class AnimatedImageBenchmark
+{
+	private const int FrameCount = 48;
+	private const int FrameDelay = 4; // in 1/100s
+	private static readonly TimeSpan PlaybackTime = TimeSpan.FromSeconds(1);
+	private static readonly TimeSpan VSync = TimeSpan.FromTicks(TimeSpan.TicksPerSecond / 60);
+
+	private byte[] gif;
+	private SKSurface surface;
+
+	private long operations;
+	private long droppedFrames;
+	private TimeSpan cpuTime;
+
+	[Params(512, 1920)]
+	public int Width;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		gif = CreateAnimatedGif(Width, Width * 9 / 16, FrameCount);
+		surface = SKSurface.Create(new SKImageInfo(Width, Width * 9 / 16));
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		var seconds = operations * PlaybackTime.TotalSeconds;
+		Console.WriteLine($"Dropped frames per second: {droppedFrames / seconds:0.##}, CPU per second: {cpuTime.TotalMilliseconds / seconds:0.##} ms");
+
+		surface.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public void DecodeOnUiThread()
+	{
+		using var data = SKData.CreateCopy(gif);
+		using var codec = SKCodec.Create(data);
+		using var bitmap = new SKBitmap(new SKImageInfo(codec.Info.Width, codec.Info.Height, SKImageInfo.PlatformColorType, SKAlphaType.Premul));
+
+		var frames = codec.FrameInfo;
+		var starts = new int[frames.Length];
+		for (var i = 1; i < frames.Length; i++)
+			starts[i] = starts[i - 1] + frames[i - 1].Duration;
+		var duration = starts[frames.Length - 1] + frames[frames.Length - 1].Duration;
+
+		var shown = -1L;
+		Play(elapsed =>
+		{
+			var loops = (long)elapsed.TotalMilliseconds / duration;
+			var ms = (int)(elapsed.TotalMilliseconds % duration);
+			var index = Array.FindLastIndex(starts, s => s <= ms);
+			var sequence = loops * frames.Length + index;
+
+			if (sequence != shown)
+			{
+				// the codec composes all the required frames every time
+				codec.GetPixels(bitmap.Info, bitmap.GetPixels(), new SKCodecOptions(index));
+				if (shown >= 0 && sequence > shown + 1)
+					droppedFrames += sequence - shown - 1;
+				shown = sequence;
+			}
+
+			surface.Canvas.DrawBitmap(bitmap, 0, 0);
+		});
+	}
+
+	[Benchmark]
+	public void PlayerWithLookAhead()
+	{
+		using var data = SKData.CreateCopy(gif);
+		using var image = SKAnimatedImage.Create(data);
+		using var player = image.CreatePlayer();
+
+		var last = TimeSpan.Zero;
+		Play(elapsed =>
+		{
+			player.Advance(elapsed - last);
+			last = elapsed;
+
+			surface.Canvas.DrawImage(player.CurrentFrame, 0, 0);
+		});
+
+		droppedFrames += player.DroppedFrameCount;
+	}
+
+	private void Play(Action<TimeSpan> tick)
+	{
+		var cpu = Process.GetCurrentProcess().TotalProcessorTime;
+		var clock = Stopwatch.StartNew();
+
+		var next = TimeSpan.Zero;
+		while (clock.Elapsed < PlaybackTime)
+		{
+			tick(clock.Elapsed);
+			surface.Canvas.Flush();
+
+			// wait for the next vsync, skipping the ones that were missed
+			next += VSync;
+			while (next < clock.Elapsed)
+				next += VSync;
+			var wait = next - clock.Elapsed;
+			if (wait > TimeSpan.Zero)
+				Thread.Sleep(wait);
+		}
+
+		cpuTime += Process.GetCurrentProcess().TotalProcessorTime - cpu;
+		operations++;
+	}
+
+	// The C API can only encode still images, so the GIF is written by hand:
+	// a full first frame, and then a square that moves over it in each of the
+	// later frames so that every frame depends on the one before. The LZW
+	// data is not compressed, which keeps the decoder busy.
+	private static byte[] CreateAnimatedGif(int width, int height, int frameCount)
+	{
+		using var stream = new MemoryStream();
+		using var writer = new BinaryWriter(stream);
+
+		writer.Write("GIF89a".ToCharArray());
+		writer.Write((ushort)width);
+		writer.Write((ushort)height);
+		writer.Write((byte)0xF7); // global color table with 256 colors
+		writer.Write((byte)0);
+		writer.Write((byte)0);
+		for (var i = 0; i < 256; i++)
+		{
+			var color = SKColor.FromHsv(i * 360f / 256f, 80, 90);
+			writer.Write(color.Red);
+			writer.Write(color.Green);
+			writer.Write(color.Blue);
+		}
+
+		// loop forever
+		writer.Write(new byte[] { 0x21, 0xFF, 0x0B });
+		writer.Write("NETSCAPE2.0".ToCharArray());
+		writer.Write(new byte[] { 0x03, 0x01, 0x00, 0x00, 0x00 });
+
+		var square = Math.Min(width, height) / 2;
+		for (var f = 0; f < frameCount; f++)
+		{
+			// graphic control: keep the previous frame
+			writer.Write(new byte[] { 0x21, 0xF9, 0x04, 0x04 });
+			writer.Write((ushort)FrameDelay);
+			writer.Write(new byte[] { 0x00, 0x00 });
+
+			var x = f == 0 ? 0 : (width - square) * f / frameCount;
+			var y = f == 0 ? 0 : (height - square) * f / frameCount;
+			var w = f == 0 ? width : square;
+			var h = f == 0 ? height : square;
+
+			writer.Write((byte)0x2C);
+			writer.Write((ushort)x);
+			writer.Write((ushort)y);
+			writer.Write((ushort)w);
+			writer.Write((ushort)h);
+			writer.Write((byte)0);
+
+			var pixels = new byte[w * h];
+			for (var row = 0; row < h; row++)
+			{
+				for (var col = 0; col < w; col++)
+					pixels[row * w + col] = (byte)((row + col + f * 8) & 0xFF);
+			}
+
+			WriteUncompressedLzw(writer, pixels);
+		}
+
+		writer.Write((byte)0x3B);
+		writer.Flush();
+
+		return stream.ToArray();
+	}
+
+	private static void WriteUncompressedLzw(BinaryWriter writer, byte[] pixels)
+	{
+		const int ClearCode = 256;
+		const int EndCode = 257;
+		const int CodeSize = 9;
+
+		// a clear code before the table grows past 9 bits
+		const int MaxRun = 250;
+
+		var block = new MemoryStream();
+		var bits = 0;
+		var bitCount = 0;
+
+		void Emit(int code)
+		{
+			bits |= code << bitCount;
+			bitCount += CodeSize;
+			while (bitCount >= 8)
+			{
+				block.WriteByte((byte)(bits & 0xFF));
+				bits >>= 8;
+				bitCount -= 8;
+			}
+		}
+
+		for (var i = 0; i < pixels.Length; i++)
+		{
+			if (i % MaxRun == 0)
+				Emit(ClearCode);
+			Emit(pixels[i]);
+		}
+		Emit(EndCode);
+		if (bitCount > 0)
+			block.WriteByte((byte)(bits & 0xFF));
+
+		writer.Write((byte)8);
+
+		var data = block.ToArray();
+		for (var offset = 0; offset < data.Length; offset += 255)
+		{
+			var count = Math.Min(255, data.Length - offset);
+			writer.Write((byte)count);
+			writer.Write(data, offset, count);
+		}
+		writer.Write((byte)0);
+	}
+}
@@ -0,0 +1,233 @@
+﻿using System;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Decoding PNGs from slow streams that deliver 16 KB every 2 ms, like a
+// download. The blocking decodes hold a thread pool thread for the whole
+// download, while the asynchronous ones only use a thread when bytes have
+// arrived. The peak number of busy thread pool threads is written out at
+// the end. The time to first pixels compares waiting for the whole image
+// with showing the first rows of the progressive decoder.
+[MemoryDiagnoser]
+[ThreadingDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class AsyncDecodeBenchmark
+{
+	private const int ChunkSize = 16 * 1024;
+	private static readonly TimeSpan ChunkDelay = TimeSpan.FromMilliseconds(2);
+
+	private byte[] png;
+
+	private Timer sampler;
+	private int peakBusyThreads;
+
+	[Params(1, 16)]
+	public int Concurrency;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		png = CreatePng(1024, 1024);
+
+		peakBusyThreads = 0;
+		sampler = new Timer(_ => SampleThreadPool(), null, 0, 1);
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		sampler.Dispose();
+		Console.WriteLine($"// Encoded size: {png.Length / 1024} KB, peak busy thread pool threads: {peakBusyThreads}");
+	}
+
+	[Benchmark(Baseline = true)]
+	public void DecodeBlocking()
+	{
+		var tasks = Enumerable.Range(0, Concurrency)
+			.Select(_ => Task.Run(() =>
+			{
+				using var bitmap = SKBitmap.Decode(new ThrottledStream(png));
+			}))
+			.ToArray();
+		Task.WaitAll(tasks);
+	}
+
+	[Benchmark]
+	public void DecodeAsync()
+	{
+		var tasks = Enumerable.Range(0, Concurrency)
+			.Select(async _ =>
+			{
+				using var bitmap = await SKBitmap.DecodeAsync(new ThrottledStream(png)).ConfigureAwait(false);
+			})
+			.ToArray();
+		Task.WaitAll(tasks);
+	}
+
+	[Benchmark]
+	public void DecodeProgressive()
+	{
+		var tasks = Enumerable.Range(0, Concurrency)
+			.Select(async _ =>
+			{
+				using var decoder = new SKProgressiveDecoder(new ThrottledStream(png), true);
+				await decoder.DecodeAsync().ConfigureAwait(false);
+			})
+			.ToArray();
+		Task.WaitAll(tasks);
+	}
+
+	[Benchmark]
+	public TimeSpan TimeToFirstPixelsBlocking()
+	{
+		var stopwatch = Stopwatch.StartNew();
+		using var bitmap = SKBitmap.Decode(new ThrottledStream(png));
+		return stopwatch.Elapsed;
+	}
+
+	[Benchmark]
+	public TimeSpan TimeToFirstPixelsProgressive()
+	{
+		var stopwatch = Stopwatch.StartNew();
+		var firstPixels = TimeSpan.Zero;
+
+		using var cts = new CancellationTokenSource();
+		using var decoder = new SKProgressiveDecoder(new ThrottledStream(png), true);
+		var progress = new FirstReport(() =>
+		{
+			firstPixels = stopwatch.Elapsed;
+			cts.Cancel();
+		});
+
+		try
+		{
+			decoder.DecodeAsync(progress, cts.Token).GetAwaiter().GetResult();
+		}
+		catch (OperationCanceledException)
+		{
+		}
+		return firstPixels;
+	}
+
+	private void SampleThreadPool()
+	{
+		ThreadPool.GetMaxThreads(out var max, out _);
+		ThreadPool.GetAvailableThreads(out var available, out _);
+
+		// the sampler itself is one of the busy threads
+		var busy = max - available - 1;
+
+		int peak;
+		while (busy > (peak = Volatile.Read(ref peakBusyThreads)))
+			Interlocked.CompareExchange(ref peakBusyThreads, busy, peak);
+	}
+
+	private static byte[] CreatePng(int width, int height)
+	{
+		using var surface = SKSurface.Create(new SKImageInfo(width, height));
+		var canvas = surface.Canvas;
+
+		using var paint = new SKPaint
+		{
+			Shader = SKShader.CreateLinearGradient(
+				new SKPoint(0, 0), new SKPoint(width, height),
+				new[] { SKColors.SkyBlue, SKColors.Orange, SKColors.Purple },
+				SKShaderTileMode.Clamp),
+		};
+		canvas.DrawRect(0, 0, width, height, paint);
+
+		// some detail so that the image does not compress to nothing
+		var random = new Random(42);
+		using var dots = new SKPaint { IsAntialias = true };
+		for (var i = 0; i < 2000; i++)
+		{
+			dots.Color = new SKColor((uint)random.Next()).WithAlpha(128);
+			canvas.DrawCircle(random.Next(width), random.Next(height), random.Next(2, 12), dots);
+		}
+
+		using var image = surface.Snapshot();
+		using var data = image.Encode(SKEncodedImageFormat.Png, 100);
+		return data.ToArray();
+	}
+
+	private class FirstReport : IProgress<SKRectI>
+	{
+		private Action first;
+
+		public FirstReport(Action first)
+		{
+			this.first = first;
+		}
+
+		public void Report(SKRectI value)
+		{
+			Interlocked.Exchange(ref first, null)?.Invoke();
+		}
+	}
+
+	// a non-seekable stream that delivers a chunk at a time
+	private class ThrottledStream : Stream
+	{
+		private readonly byte[] data;
+		private int position;
+
+		public ThrottledStream(byte[] data)
+		{
+			this.data = data;
+		}
+
+		public override bool CanRead => true;
+
+		public override bool CanSeek => false;
+
+		public override bool CanWrite => false;
+
+		public override long Length => throw new NotSupportedException();
+
+		public override long Position
+		{
+			get => position;
+			set => throw new NotSupportedException();
+		}
+
+		public override int Read(byte[] buffer, int offset, int count)
+		{
+			Thread.Sleep(ChunkDelay);
+			return ReadChunk(buffer, offset, count);
+		}
+
+		public override async Task<int> ReadAsync(byte[] buffer, int offset, int count, CancellationToken cancellationToken)
+		{
+			await Task.Delay(ChunkDelay, cancellationToken).ConfigureAwait(false);
+			return ReadChunk(buffer, offset, count);
+		}
+
+		private int ReadChunk(byte[] buffer, int offset, int count)
+		{
+			var read = Math.Min(Math.Min(count, ChunkSize), data.Length - position);
+			Buffer.BlockCopy(data, position, buffer, offset, read);
+			position += read;
+			return read;
+		}
+
+		public override void Flush()
+		{
+		}
+
+		public override long Seek(long offset, SeekOrigin origin) =>
+			throw new NotSupportedException();
+
+		public override void SetLength(long value) =>
+			throw new NotSupportedException();
+
+		public override void Write(byte[] buffer, int offset, int count) =>
+			throw new NotSupportedException();
+	}
+}
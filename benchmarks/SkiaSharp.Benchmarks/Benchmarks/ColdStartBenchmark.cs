@@ -0,0 +1,122 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+
+namespace SkiaSharp.Benchmarks;
+
+// Measures the time from process launch to the first encoded PNG.
+//
+// This can't be a BenchmarkDotNet benchmark as everything interesting
+// happens once per process, so the benchmark launches itself as a worker:
+//
+//   dotnet run -c Release -f net6.0 -- --cold-start [iterations]
+public static class ColdStartBenchmark
+{
+	public const string Argument = "--cold-start";
+	public const string WorkerArgument = "--cold-start-worker";
+
+	private const string StepPrefix = "step:";
+
+	public static int Run(string[] args)
+	{
+		var iterations = args.Length > 1 ? int.Parse(args[1]) : 20;
+
+		// warm the OS file cache so the first run is not an outlier
+		RunWorkerProcess(out _);
+
+		var totals = new List<double>();
+		var steps = new Dictionary<string, List<double>>();
+
+		for (var i = 0; i < iterations; i++)
+		{
+			var elapsed = RunWorkerProcess(out var output);
+			totals.Add(elapsed.TotalMilliseconds);
+
+			foreach (var line in output.Where(l => l.StartsWith(StepPrefix)))
+			{
+				var parts = line.Substring(StepPrefix.Length).Split('=');
+				if (!steps.TryGetValue(parts[0], out var list))
+					steps[parts[0]] = list = new List<double>();
+				list.Add(double.Parse(parts[1], System.Globalization.CultureInfo.InvariantCulture));
+			}
+		}
+
+		Console.WriteLine($"Process launch to first PNG ({iterations} runs):");
+		Console.WriteLine($"  mean   {totals.Average(),10:0.00} ms");
+		Console.WriteLine($"  median {Median(totals),10:0.00} ms");
+		Console.WriteLine($"  min    {totals.Min(),10:0.00} ms");
+		Console.WriteLine();
+		Console.WriteLine("Startup steps (median):");
+		foreach (var step in steps)
+			Console.WriteLine($"  {step.Key,-32} {Median(step.Value),10:0.000} ms");
+
+		return 0;
+	}
+
+	public static int RunWorker()
+	{
+		SKStartupTrace.IsEnabled = true;
+
+		var info = new SKImageInfo(256, 256);
+		using (var surface = SKSurface.Create(info))
+		{
+			surface.Canvas.Clear(SKColors.White);
+			using (var paint = new SKPaint { Color = SKColors.Red, IsAntialias = true })
+				surface.Canvas.DrawCircle(128, 128, 100, paint);
+
+			using var image = surface.Snapshot();
+			using var data = image.Encode(SKEncodedImageFormat.Png, 100);
+			if (data.Size == 0)
+				return 1;
+		}
+
+		foreach (var step in SKStartupTrace.GetSteps())
+			Console.WriteLine($"{StepPrefix}{step.Name}={step.Elapsed.TotalMilliseconds.ToString(System.Globalization.CultureInfo.InvariantCulture)}");
+
+		return 0;
+	}
+
+	private static TimeSpan RunWorkerProcess(out List<string> output)
+	{
+		var host = Process.GetCurrentProcess().MainModule.FileName;
+		var arguments = WorkerArgument;
+
+		// running as "dotnet SkiaSharp.Benchmarks.dll" so the dll has to be passed on
+		var hostName = Path.GetFileNameWithoutExtension(host);
+		if (string.Equals(hostName, "dotnet", StringComparison.OrdinalIgnoreCase))
+			arguments = $"\"{typeof(ColdStartBenchmark).Assembly.Location}\" {arguments}";
+
+		var psi = new ProcessStartInfo(host, arguments)
+		{
+			UseShellExecute = false,
+			RedirectStandardOutput = true,
+			CreateNoWindow = true,
+		};
+
+		var lines = new List<string>();
+		var sw = Stopwatch.StartNew();
+		using (var process = Process.Start(psi))
+		{
+			string line;
+			while ((line = process.StandardOutput.ReadLine()) != null)
+				lines.Add(line);
+			process.WaitForExit();
+			sw.Stop();
+
+			if (process.ExitCode != 0)
+				throw new InvalidOperationException($"The cold start worker failed with exit code {process.ExitCode}.");
+		}
+
+		output = lines;
+		return sw.Elapsed;
+	}
+
+	private static double Median(List<double> values)
+	{
+		var sorted = values.OrderBy(v => v).ToList();
+		var mid = sorted.Count / 2;
+		return sorted.Count % 2 == 0 ? (sorted[mid - 1] + sorted[mid]) / 2 : sorted[mid];
+	}
+}
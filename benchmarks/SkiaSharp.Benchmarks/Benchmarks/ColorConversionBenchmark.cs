@@ -0,0 +1,91 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Ingesting a 12 megapixel Display P3 photo into a print pipeline, either
+// to sRGB 8888 or to linear F16 for compositing. The serial case is a
+// single ReadPixels with the destination info, and the converter splits the
+// same work into bands on a number of threads. Megapixels per second is the
+// megapixels that are printed at the start divided by the mean time.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class ColorConversionBenchmark
+{
+	private const int Width = 4000;
+	private const int Height = 3000;
+
+	private SKColorSpace displayP3;
+	private SKBitmap source;
+	private SKBitmap destination;
+	private SKPixmap sourcePixmap;
+	private SKPixmap destinationPixmap;
+
+	[Params("Srgb8888", "LinearF16")]
+	public string Target;
+
+	[Params(1, 2, 4, 8)]
+	public int Threads;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		displayP3 = SKColorSpace.CreateRgb(SKColorSpaceTransferFn.Srgb, SKColorSpaceXyz.DisplayP3);
+		source = new SKBitmap(new SKImageInfo(Width, Height, SKColorType.Rgba8888, SKAlphaType.Premul, displayP3));
+
+		// a smooth photo-like gradient rather than noise
+		using (var canvas = new SKCanvas(source))
+		using (var paint = new SKPaint())
+		{
+			paint.Shader = SKShader.CreateLinearGradient(
+				new SKPoint(0, 0),
+				new SKPoint(Width, Height),
+				new[] { SKColors.OrangeRed, SKColors.SeaGreen, SKColors.MidnightBlue, SKColors.Gold },
+				SKShaderTileMode.Clamp);
+			canvas.DrawPaint(paint);
+		}
+
+		var info = Target == "Srgb8888"
+			? new SKImageInfo(Width, Height, SKColorType.Rgba8888, SKAlphaType.Premul, SKColorSpace.CreateSrgb())
+			: new SKImageInfo(Width, Height, SKColorType.RgbaF16, SKAlphaType.Premul, SKColorSpace.CreateSrgbLinear());
+		destination = new SKBitmap(info);
+
+		sourcePixmap = source.PeekPixels();
+		destinationPixmap = destination.PeekPixels();
+
+		// make sure that both give the same pixels before timing them
+		Serial();
+		var serial = destination.Bytes;
+		destination.Erase(SKColors.Transparent);
+		Converter();
+		var parallel = destination.Bytes;
+
+		var different = 0;
+		for (var i = 0; i < serial.Length; i++)
+		{
+			if (serial[i] != parallel[i])
+				different++;
+		}
+
+		Console.WriteLine($"// Megapixels: {Width * Height / 1_000_000.0}, different bytes: {different} of {serial.Length}");
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		sourcePixmap.Dispose();
+		destinationPixmap.Dispose();
+		source.Dispose();
+		destination.Dispose();
+		displayP3.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public bool Serial() =>
+		sourcePixmap.ReadPixels(destinationPixmap);
+
+	[Benchmark]
+	public bool Converter() =>
+		SKColorConverter.Convert(sourcePixmap, destinationPixmap, Threads);
+}
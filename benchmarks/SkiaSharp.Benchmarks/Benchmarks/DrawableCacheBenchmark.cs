@@ -0,0 +1,138 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// A dashboard of cards with blurred shadows and gradients, where only a few
+// of the cards change every frame. Each operation draws one frame, with and
+// without the raster cache.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class DrawableCacheBenchmark
+{
+	private const int Columns = 8;
+	private const int Rows = 6;
+	private const int CardWidth = 220;
+	private const int CardHeight = 160;
+	private const int Spacing = 20;
+
+	private SKSurface surface;
+	private CardDrawable[] cards;
+	private int frame;
+
+	[Params(false, true)]
+	public bool Cached;
+
+	[Params(4)]
+	public int AnimatedCards;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		surface = SKSurface.Create(new SKImageInfo(
+			Columns * (CardWidth + Spacing) + Spacing,
+			Rows * (CardHeight + Spacing) + Spacing));
+
+		cards = new CardDrawable[Columns * Rows];
+		for (var i = 0; i < cards.Length; i++)
+			cards[i] = new CardDrawable(i) { IsRasterCacheEnabled = Cached };
+
+		SKDrawableCache.Clear();
+		SKDrawableCache.ResetStatistics();
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		Console.WriteLine($"Hits: {SKDrawableCache.HitCount}, Misses: {SKDrawableCache.MissCount}, Evictions: {SKDrawableCache.EvictionCount}, Bytes: {SKDrawableCache.CurrentBytes}");
+
+		foreach (var card in cards)
+			card.Dispose();
+		surface.Dispose();
+	}
+
+	[Benchmark]
+	public void DrawFrame()
+	{
+		frame++;
+
+		// the animated cards are spread over the grid
+		for (var i = 0; i < AnimatedCards; i++)
+			cards[i * cards.Length / AnimatedCards].Update(frame);
+
+		var canvas = surface.Canvas;
+		canvas.Clear(SKColors.WhiteSmoke);
+
+		for (var i = 0; i < cards.Length; i++)
+		{
+			var x = Spacing + (i % Columns) * (CardWidth + Spacing);
+			var y = Spacing + (i / Columns) * (CardHeight + Spacing);
+			canvas.DrawDrawable(cards[i], x, y);
+		}
+
+		canvas.Flush();
+	}
+
+	private class CardDrawable : SKDrawable
+	{
+		private readonly int index;
+		private float progress;
+
+		public CardDrawable(int index)
+		{
+			this.index = index;
+		}
+
+		public void Update(int frame)
+		{
+			progress = (frame % 60) / 60f;
+			NotifyDrawingChanged();
+		}
+
+		protected override SKRect OnGetBounds() =>
+			SKRect.Create(-16, -16, CardWidth + 32, CardHeight + 32);
+
+		protected override void OnDraw(SKCanvas canvas)
+		{
+			var card = SKRect.Create(CardWidth, CardHeight);
+
+			using (var shadow = new SKPaint
+			{
+				Color = SKColors.Black.WithAlpha(80),
+				ImageFilter = SKImageFilter.CreateDropShadowOnly(0, 4, 8, 8, SKColors.Black.WithAlpha(80)),
+			})
+			{
+				canvas.DrawRoundRect(card, 12, 12, shadow);
+			}
+
+			using (var background = new SKPaint { IsAntialias = true })
+			{
+				background.Shader = SKShader.CreateLinearGradient(
+					new SKPoint(0, 0),
+					new SKPoint(CardWidth, CardHeight),
+					new[] { SKColor.FromHsv(index * 7 % 360, 40, 100), SKColor.FromHsv(index * 7 % 360, 70, 80) },
+					SKShaderTileMode.Clamp);
+				canvas.DrawRoundRect(card, 12, 12, background);
+			}
+
+			using (var chart = new SKPaint { IsAntialias = true, Style = SKPaintStyle.Stroke, StrokeWidth = 3, Color = SKColors.White })
+			using (var path = new SKPath())
+			{
+				path.MoveTo(16, CardHeight - 24);
+				for (var x = 0; x <= 10; x++)
+				{
+					var value = (float)Math.Sin((x + index + progress * 10) * 0.7) * 0.5f + 0.5f;
+					path.LineTo(16 + x * (CardWidth - 32) / 10f, CardHeight - 24 - value * (CardHeight - 72));
+				}
+				canvas.DrawPath(path, chart);
+			}
+
+			using (var font = new SKFont(SKTypeface.Default, 18))
+			using (var text = new SKPaint { IsAntialias = true, Color = SKColors.White })
+			{
+				canvas.DrawText($"Metric {index}", 16, 30, font, text);
+			}
+		}
+	}
+}
@@ -0,0 +1,116 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// A gallery of large photos that is scrolled one row per frame and drawn as
+// 200px thumbnails, decoding every visible photo versus using an image cache.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class ImageCacheBenchmark
+{
+	private const int Columns = 4;
+	private const int VisibleRows = 4;
+	private const int ThumbnailSize = 200;
+
+	private SKSurface surface;
+	private SKPaint paint;
+	private SKImageCache cache;
+	private byte[][] photos;
+	private string[] keys;
+	private int firstRow;
+
+	[Params(16, 64)]
+	public int PhotoCount;
+
+	[Params(4000)]
+	public int PhotoWidth;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		surface = SKSurface.Create(new SKImageInfo(Columns * ThumbnailSize, VisibleRows * ThumbnailSize));
+		paint = new SKPaint { FilterQuality = SKFilterQuality.Medium };
+		cache = new SKImageCache(32 * 1024 * 1024);
+
+		// only a few distinct photos are encoded, the gallery repeats them
+		// under different keys so that every cell is a different source
+		var distinct = new byte[4][];
+		for (var i = 0; i < distinct.Length; i++)
+			distinct[i] = CreatePhoto(PhotoWidth, PhotoWidth * 3 / 4, i);
+
+		photos = new byte[PhotoCount][];
+		keys = new string[PhotoCount];
+		for (var i = 0; i < PhotoCount; i++)
+		{
+			photos[i] = distinct[i % distinct.Length];
+			keys[i] = $"photo-{i}";
+		}
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		Console.WriteLine($"Hits: {cache.HitCount}, Misses: {cache.MissCount}, Evictions: {cache.EvictionCount}, Bytes: {cache.CurrentBytes}");
+
+		cache.Dispose();
+		paint.Dispose();
+		surface.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public void ScrollWithoutCache()
+	{
+		DrawFrame((canvas, index, rect) =>
+		{
+			using var image = SKImage.FromEncodedData(photos[index]);
+			canvas.DrawImage(image, rect, paint);
+		});
+	}
+
+	[Benchmark]
+	public void ScrollWithCache()
+	{
+		DrawFrame((canvas, index, rect) =>
+		{
+			var photo = photos[index];
+			using var cached = cache.GetImage(keys[index], () => SKData.CreateCopy(photo), new SKSizeI(ThumbnailSize, ThumbnailSize));
+			canvas.DrawImage(cached.Image, rect, paint);
+		});
+	}
+
+	private void DrawFrame(Action<SKCanvas, int, SKRect> drawPhoto)
+	{
+		var canvas = surface.Canvas;
+		canvas.Clear(SKColors.White);
+
+		var rows = PhotoCount / Columns;
+		for (var row = 0; row < VisibleRows; row++)
+		{
+			for (var column = 0; column < Columns; column++)
+			{
+				var index = ((firstRow + row) % rows) * Columns + column;
+				var rect = SKRect.Create(column * ThumbnailSize, row * ThumbnailSize, ThumbnailSize, ThumbnailSize * 3 / 4);
+				drawPhoto(canvas, index, rect);
+			}
+		}
+
+		surface.Flush();
+		firstRow++;
+	}
+
+	private static byte[] CreatePhoto(int width, int height, int seed)
+	{
+		using var bitmap = new SKBitmap(width, height);
+		using (var canvas = new SKCanvas(bitmap))
+		using (var shader = SKShader.CreatePerlinNoiseTurbulence(0.01f, 0.01f, 4, seed))
+		using (var noise = new SKPaint { Shader = shader })
+		{
+			canvas.DrawRect(0, 0, width, height, noise);
+		}
+
+		using var data = bitmap.Encode(SKEncodedImageFormat.Jpeg, 85);
+		return data.ToArray();
+	}
+}
@@ -0,0 +1,121 @@
+﻿using System;
+using System.IO;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Encoding into .NET streams with and without write coalescing in the
+// SKManagedWStream, counting the write callbacks, the writes to the .NET
+// stream and the bytes copied into managed memory.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class ManagedWStreamBenchmark
+{
+	private SKBitmap bitmap;
+	private SKPicture picture;
+	private SKFont font;
+	private SKPaint paint;
+	private string tempFile;
+
+	private long callbacks;
+	private long streamWrites;
+	private long bytesCopied;
+	private long operations;
+
+	[Params(0, SKManagedWStream.DefaultBufferSize)]
+	public int BufferSize;
+
+	[Params(false, true)]
+	public bool UseFileStream;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		bitmap = new SKBitmap(1024, 1024);
+		using (var canvas = new SKCanvas(bitmap))
+		using (var shader = SKShader.CreatePerlinNoiseTurbulence(0.02f, 0.02f, 4, 0))
+		using (var noise = new SKPaint { Shader = shader })
+		{
+			canvas.DrawRect(0, 0, 1024, 1024, noise);
+		}
+
+		font = new SKFont(SKTypeface.Default, 10);
+		paint = new SKPaint { Color = SKColors.Black, IsAntialias = true };
+
+		using (var recorder = new SKPictureRecorder())
+		{
+			var canvas = recorder.BeginRecording(SKRect.Create(612, 792));
+			DrawPage(canvas, 0);
+			picture = recorder.EndRecording();
+		}
+
+		tempFile = Path.GetTempFileName();
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		if (operations > 0)
+		{
+			Console.WriteLine(
+				$"Per operation: {callbacks / operations} callbacks, " +
+				$"{streamWrites / operations} stream writes, " +
+				$"{bytesCopied / operations} bytes copied");
+		}
+
+		File.Delete(tempFile);
+		picture.Dispose();
+		paint.Dispose();
+		font.Dispose();
+		bitmap.Dispose();
+	}
+
+	[Benchmark]
+	public void EncodePng() =>
+		Write(stream => bitmap.Encode(stream, SKEncodedImageFormat.Png, 100));
+
+	[Benchmark]
+	public void WritePdf() =>
+		Write(stream =>
+		{
+			using var document = SKDocument.CreatePdf(stream);
+			for (var page = 0; page < 20; page++)
+			{
+				var canvas = document.BeginPage(612, 792);
+				DrawPage(canvas, page);
+				document.EndPage();
+			}
+			document.Close();
+		});
+
+	[Benchmark]
+	public void SerializePicture() =>
+		Write(stream => picture.Serialize(stream));
+
+	private void Write(Action<SKWStream> write)
+	{
+		using var dotnet = UseFileStream
+			? new FileStream(tempFile, FileMode.Create, FileAccess.Write, FileShare.None, 4096)
+			: (Stream)new MemoryStream();
+
+		using var stream = new SKManagedWStream(dotnet, false, BufferSize);
+		write(stream);
+		stream.Flush();
+
+		callbacks += stream.WriteCallbackCount;
+		streamWrites += stream.StreamWriteCount;
+		bytesCopied += stream.BytesCopied;
+		operations++;
+	}
+
+	private void DrawPage(SKCanvas canvas, int page)
+	{
+		for (var line = 0; line < 60; line++)
+		{
+			var y = 40 + line * 12;
+			canvas.DrawText($"Page {page + 1}, line {line + 1}: the quick brown fox jumps over the lazy dog", 40, y, font, paint);
+			canvas.DrawLine(40, y + 2, 572, y + 2, paint);
+		}
+	}
+}
@@ -0,0 +1,63 @@
+﻿using System;
+using System.Threading;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Creating and disposing a large graph of objects where each parent owns
+// and keeps alive a number of children. Most objects in a real app have no
+// children at all, or just one, so those are the cases that matter most for
+// the per-object memory.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class ObjectOwnershipBenchmark
+{
+	private static long nextHandle = 0x10000;
+
+	[Params(10_000)]
+	public int ParentCount;
+
+	[Params(0, 1, 8)]
+	public int ChildrenPerParent;
+
+	[Benchmark]
+	public void CreateAndDisposeGraph()
+	{
+		var parents = new GraphObject[ParentCount];
+
+		for (var i = 0; i < parents.Length; i++) {
+			var parent = new GraphObject();
+			for (var c = 0; c < ChildrenPerParent; c++) {
+				SKObject.OwnedBy(new GraphObject(), parent);
+				SKObject.Referenced(parent, new GraphObject());
+			}
+			parents[i] = parent;
+		}
+
+		foreach (var parent in parents)
+			parent.Dispose();
+	}
+
+	[Benchmark]
+	public void CreateAndDisposeFonts()
+	{
+		// each paint owns the font that it creates for the text properties
+		for (var i = 0; i < ParentCount; i++) {
+			using var paint = new SKPaint();
+			paint.TextSize = 20;
+		}
+	}
+
+	private class GraphObject : SKObject
+	{
+		public GraphObject()
+			: base((IntPtr)Interlocked.Increment(ref nextHandle), true)
+		{
+		}
+
+		protected override void DisposeNative()
+		{
+		}
+	}
+}
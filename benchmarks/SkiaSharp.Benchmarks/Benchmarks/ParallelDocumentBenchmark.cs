@@ -0,0 +1,104 @@
+﻿using System;
+using System.Diagnostics;
+using System.IO;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class ParallelDocumentBenchmark
+{
+	private SKTypeface typeface;
+
+	[Params(200, 2000)]
+	public int Pages;
+
+	[Params(1, 2, 4, 8)]
+	public int Cores;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		typeface = SKTypeface.Default;
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		// BenchmarkDotNet only tracks the managed heap, the pictures are native
+		using var process = Process.GetCurrentProcess();
+		Console.WriteLine($"// Peak working set: {process.PeakWorkingSet64 / 1024 / 1024} MB");
+	}
+
+	[Benchmark(Baseline = true)]
+	public long Sequential()
+	{
+		using var stream = new CountingStream();
+		using (var doc = SKDocument.CreatePdf(stream))
+		{
+			for (var i = 0; i < Pages; i++)
+			{
+				var canvas = doc.BeginPage(595, 842);
+				DrawInvoicePage(canvas, i);
+				doc.EndPage();
+			}
+			doc.Close();
+		}
+		return stream.Length;
+	}
+
+	[Benchmark]
+	public long Parallel()
+	{
+		using var stream = new CountingStream();
+		using (var doc = SKDocument.CreatePdf(stream))
+		using (var builder = new SKParallelDocumentBuilder(doc, Cores))
+		{
+			for (var i = 0; i < Pages; i++)
+			{
+				var page = i;
+				builder.AddPage(595, 842, canvas => DrawInvoicePage(canvas, page));
+			}
+			builder.Close();
+		}
+		return stream.Length;
+	}
+
+	private void DrawInvoicePage(SKCanvas canvas, int page)
+	{
+		using var font = new SKFont(typeface, 10);
+		using var paint = new SKPaint { IsAntialias = true };
+		using var line = new SKPaint { IsStroke = true, StrokeWidth = 0.5f, Color = SKColors.Gray };
+
+		canvas.DrawText($"Invoice page {page + 1}", 40, 40, font, paint);
+
+		for (var row = 0; row < 60; row++)
+		{
+			var y = 80 + row * 12;
+			canvas.DrawLine(40, y + 2, 555, y + 2, line);
+			canvas.DrawText($"Item {page * 60 + row:000000}", 40, y, font, paint);
+			canvas.DrawText($"{(page * 31 + row * 17) % 1000,6}.00", 480, y, font, paint);
+		}
+	}
+
+	// a write-only stream that does not keep the bytes so that only
+	// the document pipeline shows up in the memory numbers
+	private class CountingStream : Stream
+	{
+		private long length;
+
+		public override bool CanRead => false;
+		public override bool CanSeek => false;
+		public override bool CanWrite => true;
+		public override long Length => length;
+		public override long Position { get => length; set => throw new NotSupportedException(); }
+
+		public override void Flush() { }
+		public override int Read(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+		public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+		public override void SetLength(long value) => throw new NotSupportedException();
+		public override void Write(byte[] buffer, int offset, int count) => length += count;
+	}
+}
@@ -0,0 +1,79 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Placing markers along a long route, sampling the position and tangent one
+// distance at a time versus with the batch APIs.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class PathMeasureBenchmark
+{
+	private SKPath path;
+	private SKPathMeasure measure;
+	private float[] distances;
+	private SKPoint[] positions;
+	private SKPoint[] tangents;
+	private float step;
+
+	[Params(1_000, 10_000, 100_000)]
+	public int SampleCount;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		var random = new Random(42);
+
+		path = new SKPath();
+		path.MoveTo(0, 0);
+		for (var i = 1; i <= 500; i++)
+		{
+			var x = i * 20f;
+			var y = (float)random.NextDouble() * 200f;
+			if (i % 3 == 0)
+				path.QuadTo(x - 10, y + 50, x, y);
+			else
+				path.LineTo(x, y);
+		}
+
+		measure = new SKPathMeasure(path);
+		step = measure.Length / SampleCount;
+
+		distances = new float[SampleCount];
+		SKPathMeasure.GetEvenlySpacedDistances(measure.Length, step, 0, distances);
+
+		positions = new SKPoint[SampleCount];
+		tangents = new SKPoint[SampleCount];
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		measure.Dispose();
+		path.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public void PerSample()
+	{
+		for (var i = 0; i < distances.Length; i++)
+		{
+			measure.GetPositionAndTangent(distances[i], out var position, out var tangent);
+			positions[i] = position;
+			tangents[i] = tangent;
+		}
+	}
+
+	[Benchmark]
+	public void BatchDistances() =>
+		measure.GetPositionsAndTangents(distances, positions, tangents);
+
+	[Benchmark]
+	public void BatchStep() =>
+		measure.GetPositionsAndTangents(0, step, SampleCount, positions, tangents);
+
+	[Benchmark]
+	public void BatchAllContours() =>
+		SKPathMeasure.GetPositionsAndTangents(path, distances, positions, tangents);
+}
@@ -0,0 +1,83 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Merging a city block of overlapping building footprints into one path,
+// with a single OpBuilder versus the bulk union on a number of threads.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class PathUnionBenchmark
+{
+	private SKPath[] paths;
+
+	[Params(1_000, 10_000)]
+	public int PathCount;
+
+	[Params(1, 2, 4, 8)]
+	public int Threads;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		var random = new Random(42);
+		var columns = (int)Math.Ceiling(Math.Sqrt(PathCount));
+
+		paths = new SKPath[PathCount];
+		for (var i = 0; i < PathCount; i++)
+		{
+			// an L-shaped building that overlaps its neighbours
+			var w = 20 + random.Next(16);
+			var h = 20 + random.Next(16);
+			var path = new SKPath();
+			path.MoveTo(0, 0);
+			path.LineTo(w, 0);
+			path.LineTo(w, h / 2);
+			path.LineTo(w / 2, h / 2);
+			path.LineTo(w / 2, h);
+			path.LineTo(0, h);
+			path.Close();
+			path.Transform(SKMatrix.CreateRotationDegrees(random.Next(360))
+				.PostConcat(SKMatrix.CreateTranslation((i % columns) * 24, (i / columns) * 24)));
+			paths[i] = path;
+		}
+
+		// make sure that both give the same result before timing them
+		using var serial = ResolveSerially();
+		using var bulk = SKPath.Union(paths, Threads);
+		using var difference = serial.Op(bulk, SKPathOp.Xor);
+		var area = difference.Bounds.Width * difference.Bounds.Height;
+		Console.WriteLine($"Serial bounds: {serial.Bounds}, bulk bounds: {bulk.Bounds}, XOR bounds area: {area}");
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		foreach (var path in paths)
+			path.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public void SerialOpBuilder()
+	{
+		using var result = ResolveSerially();
+	}
+
+	[Benchmark]
+	public void BulkUnion()
+	{
+		using var result = SKPath.Union(paths, Threads);
+	}
+
+	private SKPath ResolveSerially()
+	{
+		using var builder = new SKPath.OpBuilder();
+		foreach (var path in paths)
+			builder.Add(path, SKPathOp.Union);
+
+		var result = new SKPath();
+		builder.Resolve(result);
+		return result;
+	}
+}
@@ -0,0 +1,182 @@
+﻿using System;
+using System.IO;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// A screen of vector map tiles, each with roads, areas and labels, that an
+// app draws as soon as it starts. Each operation starts the screen again:
+// either by recording the tiles from scratch, or by opening the picture
+// cache and drawing the tiles that were cached by the previous run. The
+// deserialize cases compare reading the pictures from the mapped cache
+// with reading the same bytes from a file stream.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class PictureCacheBenchmark
+{
+	private const int TileSize = 256;
+	private const int Columns = 4;
+	private const int Rows = 3;
+
+	private string directory;
+	private string[] streamFiles;
+	private SKPictureCache cache;
+	private SKSurface surface;
+	private long serializedBytes;
+
+	[Params(200, 2000)]
+	public int FeaturesPerTile;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		directory = Path.Combine(Path.GetTempPath(), "skiasharp-picture-cache-" + Guid.NewGuid().ToString("N"));
+		Directory.CreateDirectory(directory);
+
+		surface = SKSurface.Create(new SKImageInfo(Columns * TileSize, Rows * TileSize));
+
+		// the previous run of the app
+		streamFiles = new string[Columns * Rows];
+		using (var previous = new SKPictureCache(Path.Combine(directory, "cache")))
+		{
+			for (var i = 0; i < streamFiles.Length; i++)
+			{
+				using var picture = RecordTile(i);
+				using var data = picture.Serialize();
+				serializedBytes += data.Size;
+
+				previous.Add(GetKey(i), data);
+
+				streamFiles[i] = Path.Combine(directory, i + ".skp");
+				using var file = File.Create(streamFiles[i]);
+				data.SaveTo(file);
+			}
+		}
+
+		cache = new SKPictureCache(Path.Combine(directory, "cache"));
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		Console.WriteLine($"// Tiles: {streamFiles.Length}, Serialized: {serializedBytes} bytes, Hits: {cache.HitCount}, Misses: {cache.MissCount}");
+
+		cache.Dispose();
+		surface.Dispose();
+		Directory.Delete(directory, true);
+	}
+
+	[Benchmark(Baseline = true)]
+	public void StartByRecording()
+	{
+		var canvas = surface.Canvas;
+		canvas.Clear(SKColors.White);
+
+		for (var i = 0; i < Columns * Rows; i++)
+		{
+			using var picture = RecordTile(i);
+			DrawTile(canvas, picture, i);
+		}
+
+		canvas.Flush();
+	}
+
+	[Benchmark]
+	public void StartFromCache()
+	{
+		// reopen the cache like a new process would, which loads the index
+		cache.Dispose();
+		cache = new SKPictureCache(Path.Combine(directory, "cache"));
+
+		var canvas = surface.Canvas;
+		canvas.Clear(SKColors.White);
+
+		for (var i = 0; i < Columns * Rows; i++)
+		{
+			var index = i;
+			using var picture = cache.GetPicture(GetKey(i), () => RecordTile(index));
+			DrawTile(canvas, picture, i);
+		}
+
+		canvas.Flush();
+	}
+
+	[Benchmark]
+	public float DeserializeFromMapping()
+	{
+		var width = 0f;
+		for (var i = 0; i < Columns * Rows; i++)
+		{
+			using var picture = cache.GetPicture(GetKey(i));
+			width += picture.CullRect.Width;
+		}
+		return width;
+	}
+
+	[Benchmark]
+	public float DeserializeFromStream()
+	{
+		var width = 0f;
+		for (var i = 0; i < streamFiles.Length; i++)
+		{
+			using var stream = File.OpenRead(streamFiles[i]);
+			using var picture = SKPicture.Deserialize(stream);
+			width += picture.CullRect.Width;
+		}
+		return width;
+	}
+
+	private SKPictureCacheKey GetKey(int tile) =>
+		SKPictureCacheKey.FromString($"tile/{FeaturesPerTile}/{tile}");
+
+	private static void DrawTile(SKCanvas canvas, SKPicture picture, int tile)
+	{
+		canvas.Save();
+		canvas.Translate((tile % Columns) * TileSize, (tile / Columns) * TileSize);
+		canvas.DrawPicture(picture);
+		canvas.Restore();
+	}
+
+	private SKPicture RecordTile(int tile)
+	{
+		var random = new Random(tile);
+
+		using var recorder = new SKPictureRecorder();
+		var canvas = recorder.BeginRecording(SKRect.Create(TileSize, TileSize));
+
+		using var area = new SKPaint { IsAntialias = true };
+		using var road = new SKPaint { IsAntialias = true, Style = SKPaintStyle.Stroke, StrokeCap = SKStrokeCap.Round, StrokeJoin = SKStrokeJoin.Round };
+		using var label = new SKPaint { IsAntialias = true, Color = SKColors.DarkSlateGray };
+		using var font = new SKFont(SKTypeface.Default, 10);
+		using var path = new SKPath();
+
+		for (var f = 0; f < FeaturesPerTile; f++)
+		{
+			path.Reset();
+			path.MoveTo(random.Next(TileSize), random.Next(TileSize));
+			for (var p = 0; p < 8; p++)
+				path.LineTo(random.Next(TileSize), random.Next(TileSize));
+
+			switch (f % 10)
+			{
+				case 0:
+					canvas.DrawText($"Street {tile}-{f}", random.Next(TileSize), random.Next(TileSize), font, label);
+					break;
+				case 1:
+				case 2:
+					path.Close();
+					area.Color = SKColor.FromHsv(random.Next(60, 160), 30, 90);
+					canvas.DrawPath(path, area);
+					break;
+				default:
+					road.Color = f % 3 == 0 ? SKColors.Orange : SKColors.LightGray;
+					road.StrokeWidth = 1 + f % 4;
+					canvas.DrawPath(path, road);
+					break;
+			}
+		}
+
+		return recorder.EndRecording();
+	}
+}
@@ -0,0 +1,76 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// The cost of wrapping a frame in a SKProfilingCanvas at various sampling intervals.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class ProfilingCanvasBenchmark
+{
+	private SKSurface surface;
+	private SKPaint fill;
+	private SKPaint stroke;
+	private SKFont font;
+	private SKProfilingCanvas profiling;
+
+	[Params(1, 16)]
+	public int SampleInterval;
+
+	[Params(false, true)]
+	public bool CaptureCallers;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		surface = SKSurface.Create(new SKImageInfo(800, 600));
+		fill = new SKPaint { Color = SKColors.SteelBlue, IsAntialias = true };
+		stroke = new SKPaint { Color = SKColors.Black, IsStroke = true, StrokeWidth = 1 };
+		font = new SKFont(SKTypeface.Default, 12);
+
+		profiling = new SKProfilingCanvas(surface.Canvas)
+		{
+			SampleInterval = SampleInterval,
+			CaptureCallers = CaptureCallers,
+		};
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		Console.WriteLine(profiling.GetReport());
+
+		profiling.Dispose();
+		font.Dispose();
+		stroke.Dispose();
+		fill.Dispose();
+		surface.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public void Direct() =>
+		DrawFrame(surface.Canvas);
+
+	[Benchmark]
+	public void Profiled() =>
+		DrawFrame(profiling);
+
+	private void DrawFrame(SKCanvas canvas)
+	{
+		canvas.Clear(SKColors.White);
+
+		for (var i = 0; i < 200; i++)
+		{
+			var x = i % 20 * 40;
+			var y = i / 20 * 60;
+
+			canvas.Save();
+			canvas.Translate(x, y);
+			canvas.DrawRect(2, 2, 36, 36, fill);
+			canvas.DrawRect(2, 2, 36, 36, stroke);
+			canvas.DrawText("A" + (i % 10), 4, 54, font, stroke);
+			canvas.Restore();
+		}
+	}
+}
@@ -0,0 +1,149 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Drawing a frame of sprites from a single atlas, one DrawImage per sprite
+// versus an SKSpriteBatch. A quarter of the sprites are outside the frame
+// so that the culling has something to do.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class SpriteBatchBenchmark
+{
+	private const int Width = 1920;
+	private const int Height = 1080;
+	private const int TileSize = 32;
+	private const int TilesPerRow = 8;
+
+	private SKSurface surface;
+	private SKImage atlas;
+	private SKPaint paint;
+	private SKSpriteBatch batch;
+	private SKSpriteBatch culledBatch;
+
+	private SKRect[] sources;
+	private SKPoint[] positions;
+	private float[] rotations;
+	private SKColor[] tints;
+
+	[Params(10_000, 100_000)]
+	public int SpriteCount;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		surface = SKSurface.Create(new SKImageInfo(Width, Height));
+		paint = new SKPaint { FilterQuality = SKFilterQuality.Low };
+		atlas = CreateAtlas();
+
+		batch = new SKSpriteBatch(surface.Canvas, paint);
+		culledBatch = new SKSpriteBatch(surface.Canvas, paint) { CullToClip = true };
+
+		var random = new Random(42);
+		sources = new SKRect[SpriteCount];
+		positions = new SKPoint[SpriteCount];
+		rotations = new float[SpriteCount];
+		tints = new SKColor[SpriteCount];
+		for (var i = 0; i < SpriteCount; i++)
+		{
+			var tile = random.Next(TilesPerRow * TilesPerRow);
+			sources[i] = SKRect.Create(tile % TilesPerRow * TileSize, tile / TilesPerRow * TileSize, TileSize, TileSize);
+
+			var offscreen = i % 4 == 0;
+			positions[i] = offscreen
+				? new SKPoint(Width + random.Next(100, 1000), random.Next(Height))
+				: new SKPoint(random.Next(-TileSize, Width), random.Next(-TileSize, Height));
+
+			rotations[i] = random.Next(360);
+			tints[i] = new SKColor((uint)random.Next() | 0xFF000000);
+		}
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		culledBatch.Dispose();
+		batch.Dispose();
+		atlas.Dispose();
+		paint.Dispose();
+		surface.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public void DrawImagePerSprite()
+	{
+		var canvas = surface.Canvas;
+		canvas.Clear(SKColors.Black);
+
+		for (var i = 0; i < sources.Length; i++)
+		{
+			var p = positions[i];
+			canvas.DrawImage(atlas, sources[i], SKRect.Create(p.X, p.Y, TileSize, TileSize), paint);
+		}
+
+		surface.Flush();
+	}
+
+	[Benchmark]
+	public void SpriteBatch()
+	{
+		surface.Canvas.Clear(SKColors.Black);
+
+		for (var i = 0; i < sources.Length; i++)
+		{
+			var p = positions[i];
+			batch.Draw(atlas, sources[i], p.X, p.Y);
+		}
+		batch.Flush();
+
+		surface.Flush();
+	}
+
+	[Benchmark]
+	public void SpriteBatchCulled()
+	{
+		surface.Canvas.Clear(SKColors.Black);
+
+		for (var i = 0; i < sources.Length; i++)
+		{
+			var p = positions[i];
+			culledBatch.Draw(atlas, sources[i], p.X, p.Y);
+		}
+		culledBatch.Flush();
+
+		surface.Flush();
+	}
+
+	[Benchmark]
+	public void SpriteBatchRotatedAndTinted()
+	{
+		surface.Canvas.Clear(SKColors.Black);
+
+		var anchor = new SKPoint(TileSize / 2, TileSize / 2);
+		for (var i = 0; i < sources.Length; i++)
+			batch.Draw(atlas, sources[i], positions[i], rotations[i], 1, anchor, tints[i]);
+		batch.Flush();
+
+		surface.Flush();
+	}
+
+	private static SKImage CreateAtlas()
+	{
+		using var atlasSurface = SKSurface.Create(new SKImageInfo(TileSize * TilesPerRow, TileSize * TilesPerRow));
+		var canvas = atlasSurface.Canvas;
+		canvas.Clear(SKColors.Transparent);
+
+		using var tilePaint = new SKPaint { IsAntialias = true };
+		for (var y = 0; y < TilesPerRow; y++)
+		{
+			for (var x = 0; x < TilesPerRow; x++)
+			{
+				tilePaint.Color = SKColor.FromHsv(360f * (y * TilesPerRow + x) / (TilesPerRow * TilesPerRow), 80, 90);
+				canvas.DrawCircle(x * TileSize + TileSize / 2, y * TileSize + TileSize / 2, TileSize / 2 - 2, tilePaint);
+			}
+		}
+
+		return atlasSurface.Snapshot();
+	}
+}
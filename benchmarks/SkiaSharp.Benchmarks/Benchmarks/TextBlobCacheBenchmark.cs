@@ -0,0 +1,96 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// A dashboard frame that redraws the same chart labels every frame, with and
+// without a text blob cache on the canvas.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class TextBlobCacheBenchmark
+{
+	private SKSurface surface;
+	private SKPaint leftPaint;
+	private SKPaint centerPaint;
+	private SKFont labelFont;
+	private SKFont titleFont;
+	private SKTextBlobCache cache;
+
+	private string[] titles;
+	private string[] axisLabels;
+	private string[] legendLabels;
+	private string[] values;
+	private int frame;
+
+	[Params(false, true)]
+	public bool UseCache;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		surface = SKSurface.Create(new SKImageInfo(1280, 720));
+		leftPaint = new SKPaint { Color = SKColors.Black, IsAntialias = true };
+		centerPaint = new SKPaint { Color = SKColors.DimGray, IsAntialias = true, TextAlign = SKTextAlign.Center };
+		labelFont = new SKFont(SKTypeface.Default, 11);
+		titleFont = new SKFont(SKTypeface.Default, 18) { Embolden = true };
+		cache = new SKTextBlobCache();
+
+		titles = new[] { "Requests per second", "Error rate", "P99 latency", "Active users", "CPU usage", "Memory usage" };
+		axisLabels = new string[24];
+		for (var i = 0; i < axisLabels.Length; i++)
+			axisLabels[i] = $"{i:00}:00";
+		legendLabels = new[] { "us-east-1", "us-west-2", "eu-west-1", "ap-southeast-2" };
+
+		var random = new Random(42);
+		values = new string[64];
+		for (var i = 0; i < values.Length; i++)
+			values[i] = (random.Next(0, 100_000) / 100.0).ToString("N2");
+
+		surface.Canvas.TextBlobCache = UseCache ? cache : null;
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		Console.WriteLine($"Hits: {cache.HitCount}, Misses: {cache.MissCount}, Evictions: {cache.EvictionCount}");
+
+		surface.Canvas.TextBlobCache = null;
+		cache.Dispose();
+		titleFont.Dispose();
+		labelFont.Dispose();
+		centerPaint.Dispose();
+		leftPaint.Dispose();
+		surface.Dispose();
+	}
+
+	[Benchmark]
+	public void DrawFrame()
+	{
+		// one of the values changes every frame, the rest of the labels do not
+		frame++;
+		values[frame % values.Length] = (frame % 100_000 / 100.0).ToString("N2");
+
+		var canvas = surface.Canvas;
+		canvas.Clear(SKColors.White);
+
+		for (var chart = 0; chart < titles.Length; chart++)
+		{
+			var left = (chart % 3) * 420f + 20;
+			var top = (chart / 3) * 350f + 30;
+
+			canvas.DrawText(titles[chart], left, top, titleFont, leftPaint);
+
+			for (var i = 0; i < axisLabels.Length; i += 2)
+				canvas.DrawText(axisLabels[i], left + 20 + i * 15, top + 300, labelFont, centerPaint);
+
+			for (var i = 0; i < legendLabels.Length; i++)
+				canvas.DrawText(legendLabels[i], left + i * 95, top + 320, labelFont, leftPaint);
+
+			for (var i = 0; i < 8; i++)
+				canvas.DrawText(values[(chart * 8 + i) % values.Length], left + 360, top + 40 + i * 30, labelFont, centerPaint);
+		}
+
+		surface.Flush();
+	}
+}
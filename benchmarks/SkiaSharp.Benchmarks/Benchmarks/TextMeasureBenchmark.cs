@@ -0,0 +1,90 @@
+﻿using System;
+using BenchmarkDotNet.Attributes;
+using BenchmarkDotNet.Jobs;
+
+namespace SkiaSharp.Benchmarks;
+
+// Measuring every cell of a grid layout one string at a time versus in a single batch.
+[MemoryDiagnoser]
+[SimpleJob(RuntimeMoniker.Net60)]
+public class TextMeasureBenchmark
+{
+	private SKFont font;
+	private string[] cells;
+	private char[] buffer;
+	private int[] lengths;
+	private float[] widths;
+	private SKRect[] bounds;
+
+	[Params(1_000, 100_000)]
+	public int CellCount;
+
+	[GlobalSetup]
+	public void GlobalSetup()
+	{
+		font = new SKFont(SKTypeface.Default, 12);
+
+		var random = new Random(42);
+		cells = new string[CellCount];
+		for (var i = 0; i < CellCount; i++)
+		{
+			cells[i] = (i % 4) switch
+			{
+				0 => $"Row {i / 8}",
+				1 => random.Next(0, 1_000_000).ToString("N0"),
+				2 => random.NextDouble().ToString("P2"),
+				_ => "Lorem ipsum dolor sit amet",
+			};
+		}
+
+		buffer = string.Concat(cells).ToCharArray();
+		lengths = Array.ConvertAll(cells, c => c.Length);
+		widths = new float[CellCount];
+		bounds = new SKRect[CellCount];
+	}
+
+	[GlobalCleanup]
+	public void GlobalCleanup()
+	{
+		font.Dispose();
+	}
+
+	[Benchmark(Baseline = true)]
+	public float PerStringWidths()
+	{
+		var total = 0f;
+		for (var i = 0; i < cells.Length; i++)
+			total += font.MeasureText(cells[i]);
+		return total;
+	}
+
+	[Benchmark]
+	public float PerStringBounds()
+	{
+		var total = 0f;
+		for (var i = 0; i < cells.Length; i++)
+			total += font.MeasureText(cells[i], out _);
+		return total;
+	}
+
+	[Benchmark]
+	public float BatchStringWidths()
+	{
+		font.MeasureText(cells, widths);
+		return widths[widths.Length - 1];
+	}
+
+	[Benchmark]
+	public float BatchBufferWidths()
+	{
+		font.MeasureText(buffer, lengths, widths);
+		return widths[widths.Length - 1];
+	}
+
+	[Benchmark]
+	public float BatchStringBounds()
+	{
+		font.MeasureText(cells, widths, bounds);
+		return widths[widths.Length - 1];
+	}
+}
@@ -4,8 +4,15 @@ namespace SkiaSharp.Benchmarks;
 
 public class Program
 {
-	public static void Main(string[] args)
+	public static int Main(string[] args)
 	{
-		var summary = BenchmarkRunner.Run<Benchmark>();
+		if (args.Length > 0 && args[0] == ColdStartBenchmark.WorkerArgument)
+			return ColdStartBenchmark.RunWorker();
+
+		if (args.Length > 0 && args[0] == ColdStartBenchmark.Argument)
+			return ColdStartBenchmark.Run(args);
+
+		BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args);
+		return 0;
 	}
 }
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.IO;
 using System.Runtime.InteropServices;
 
@@ -11,6 +12,11 @@ namespace SkiaSharp
 #if USE_DELEGATES || USE_LIBRARY_LOADER
 	internal static class LibraryLoader
 	{
+		// the probed path for each library, so that the other assemblies that load
+		// the same native library (SkiaSharp.Skottie, SkiaSharp.SceneGraph) do not
+		// have to search the file system again
+		private static readonly Dictionary<string, string> resolvedPaths = new Dictionary<string, string> ();
+
 		static LibraryLoader ()
 		{
 			if (PlatformConfiguration.IsWindows)
@@ -25,7 +31,13 @@ namespace SkiaSharp
 
 		public static IntPtr LoadLocalLibrary<T> (string libraryName)
 		{
-			var libraryPath = GetLibraryPath (libraryName);
+			string libraryPath;
+			lock (resolvedPaths) {
+				if (!resolvedPaths.TryGetValue (libraryName, out libraryPath)) {
+					libraryPath = GetLibraryPath (libraryName);
+					resolvedPaths[libraryName] = libraryPath;
+				}
+			}
 
 			var handle = LoadLibrary (libraryPath);
 			if (handle == IntPtr.Zero)
@@ -0,0 +1,586 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace SkiaSharp
+{
+	// The frames of an animated image (GIF, WebP, ...) composed and cached
+	// for playback. Each frame is composed on top of the frame that it depends
+	// on, so playing the animation in order only ever decodes each frame once.
+	// Upcoming frames are decoded on a background thread while the cache is
+	// below the memory cap, and all the players share the same frames.
+	public class SKAnimatedImage : IDisposable
+	{
+		public const long DefaultMaxBytes = 32 * 1024 * 1024;
+
+		// browsers play frames that are 10 ms or shorter at 100 ms, and many
+		// animations on the web rely on that
+		private const int MinimumFrameDuration = 10;
+		private const int DefaultFrameDuration = 100;
+
+		private readonly object locker = new object ();
+		private readonly Dictionary<int, FrameEntry> entries = new Dictionary<int, FrameEntry> ();
+		private readonly LinkedList<FrameEntry> recentlyUsed = new LinkedList<FrameEntry> ();
+		private readonly Queue<int> requests = new Queue<int> ();
+		private readonly HashSet<int> requested = new HashSet<int> ();
+
+		// the codec is not thread-safe, so all decoding happens under this lock
+		private readonly object codecLocker = new object ();
+		private readonly SKCodec codec;
+		private readonly SKCodecFrameInfo[] frames;
+		private readonly int[] frameStarts;
+
+		private long maxBytes;
+		private long currentBytes;
+		private long decodedFrameCount;
+		private long evictionCount;
+		private bool isDecoding;
+		private bool isDisposed;
+
+		// the last frame that was composed, so that the next frame only needs
+		// a copy even if the cache has no space for it
+		private FrameEntry lastComposed;
+
+		private SKAnimatedImage (SKCodec codec, long maxBytes)
+		{
+			this.codec = codec;
+			this.maxBytes = maxBytes;
+
+			Info = new SKImageInfo (codec.Info.Width, codec.Info.Height, SKImageInfo.PlatformColorType, SKAlphaType.Premul);
+			RepetitionCount = codec.RepetitionCount;
+
+			// still images have no frame information, but they have one frame
+			frames = codec.FrameInfo;
+			if (frames.Length == 0)
+				frames = new SKCodecFrameInfo[1];
+
+			var start = 0;
+			frameStarts = new int[frames.Length];
+			for (var i = 0; i < frames.Length; i++) {
+				if (frames[i].RequiredFrame >= i)
+					frames[i].RequiredFrame = -1;
+
+				frameStarts[i] = start;
+				if (frames.Length > 1)
+					start += GetFrameDuration (frames[i]);
+			}
+			Duration = TimeSpan.FromMilliseconds (start);
+		}
+
+		// Create*
+
+		public static SKAnimatedImage Create (string filename) =>
+			Create (SKCodec.Create (filename), DefaultMaxBytes);
+
+		public static SKAnimatedImage Create (Stream stream) =>
+			Create (SKCodec.Create (stream), DefaultMaxBytes);
+
+		public static SKAnimatedImage Create (SKData data) =>
+			Create (SKCodec.Create (data), DefaultMaxBytes);
+
+		public static SKAnimatedImage Create (SKCodec codec) =>
+			Create (codec, DefaultMaxBytes);
+
+		// the animated image takes ownership of the codec
+		public static SKAnimatedImage Create (SKCodec codec, long maxBytes)
+		{
+			if (maxBytes <= 0)
+				throw new ArgumentOutOfRangeException (nameof (maxBytes), "The maximum number of bytes must be greater than zero.");
+			if (codec == null)
+				return null;
+
+			return new SKAnimatedImage (codec, maxBytes);
+		}
+
+		// properties
+
+		public SKImageInfo Info { get; }
+
+		public int FrameCount => frames.Length;
+
+		public SKCodecFrameInfo[] FrameInfo => (SKCodecFrameInfo[])frames.Clone ();
+
+		// -1 means that the animation repeats forever
+		public int RepetitionCount { get; }
+
+		// the duration of a single loop of the animation
+		public TimeSpan Duration { get; }
+
+		public long MaxBytes {
+			get {
+				lock (locker) {
+					return maxBytes;
+				}
+			}
+			set {
+				if (value <= 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The maximum number of bytes must be greater than zero.");
+
+				lock (locker) {
+					maxBytes = value;
+					Trim (0);
+				}
+			}
+		}
+
+		// the pixel bytes of all the composed frames in the cache
+		public long CurrentBytes {
+			get {
+				lock (locker) {
+					return currentBytes;
+				}
+			}
+		}
+
+		public int CachedFrameCount {
+			get {
+				lock (locker) {
+					return entries.Count;
+				}
+			}
+		}
+
+		// the number of frames that were decoded, including the frames that
+		// had to be decoded again after they were evicted
+		public long DecodedFrameCount => Interlocked.Read (ref decodedFrameCount);
+
+		public long EvictionCount => Interlocked.Read (ref evictionCount);
+
+		// false if the frames that are in use leave no room in the cache for
+		// one more, in which case the prefetch requests are dropped
+		internal bool CanPrefetch {
+			get {
+				lock (locker) {
+					var leasedBytes = 0L;
+					foreach (var entry in recentlyUsed) {
+						if (entry.Leases > 0)
+							leasedBytes += entry.ByteCount;
+					}
+					return leasedBytes + Info.BytesSize64 <= maxBytes;
+				}
+			}
+		}
+
+		internal bool IsPrefetching {
+			get {
+				lock (locker) {
+					return isDecoding;
+				}
+			}
+		}
+
+		public void ResetStatistics ()
+		{
+			Interlocked.Exchange (ref decodedFrameCount, 0);
+			Interlocked.Exchange (ref evictionCount, 0);
+		}
+
+		public TimeSpan GetFrameStart (int index)
+		{
+			if (index < 0 || index >= frames.Length)
+				throw new ArgumentOutOfRangeException (nameof (index));
+
+			return TimeSpan.FromMilliseconds (frameStarts[index]);
+		}
+
+		public TimeSpan GetFrameDuration (int index)
+		{
+			if (index < 0 || index >= frames.Length)
+				throw new ArgumentOutOfRangeException (nameof (index));
+
+			return frames.Length > 1
+				? TimeSpan.FromMilliseconds (GetFrameDuration (frames[index]))
+				: TimeSpan.Zero;
+		}
+
+		// the frame that is shown at the time in a single loop
+		public int GetFrameIndex (TimeSpan time)
+		{
+			var ms = time.TotalMilliseconds;
+			if (ms <= 0)
+				return 0;
+
+			var lo = 0;
+			var hi = frameStarts.Length - 1;
+			while (lo < hi) {
+				var mid = (lo + hi + 1) / 2;
+				if (frameStarts[mid] <= ms)
+					lo = mid;
+				else
+					hi = mid - 1;
+			}
+			return lo;
+		}
+
+		public SKAnimatedImagePlayer CreatePlayer () =>
+			new SKAnimatedImagePlayer (this);
+
+		// GetFrame
+
+		// returns the composed frame, decoding it on this thread if it is not
+		// cached - the frame stays valid until it is disposed
+		public SKAnimatedImageFrame GetFrame (int index)
+		{
+			if (index < 0 || index >= frames.Length)
+				throw new ArgumentOutOfRangeException (nameof (index));
+
+			var entry = Acquire (index) ?? DecodeFrame (index);
+			return entry != null
+				? new SKAnimatedImageFrame (this, entry)
+				: null;
+		}
+
+		// returns the composed frame only if it has already been decoded
+		public bool TryGetFrame (int index, out SKAnimatedImageFrame frame)
+		{
+			if (index < 0 || index >= frames.Length)
+				throw new ArgumentOutOfRangeException (nameof (index));
+
+			var entry = Acquire (index);
+			frame = entry != null
+				? new SKAnimatedImageFrame (this, entry)
+				: null;
+			return frame != null;
+		}
+
+		// queues the frame to be decoded on a background thread, as long as
+		// there is space for it in the cache
+		public void Prefetch (int index)
+		{
+			if (index < 0 || index >= frames.Length)
+				throw new ArgumentOutOfRangeException (nameof (index));
+
+			lock (locker) {
+				if (isDisposed || entries.ContainsKey (index) || !requested.Add (index))
+					return;
+
+				requests.Enqueue (index);
+
+				if (isDecoding)
+					return;
+				isDecoding = true;
+			}
+
+			Task.Run (DecodeRequests);
+		}
+
+		public void Clear ()
+		{
+			lock (locker) {
+				requests.Clear ();
+				requested.Clear ();
+				while (recentlyUsed.Last != null)
+					Evict (recentlyUsed.Last, count: false);
+			}
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (!disposing)
+				return;
+
+			lock (locker) {
+				if (isDisposed)
+					return;
+				isDisposed = true;
+			}
+
+			// wait for any frame that is being decoded
+			lock (codecLocker) {
+				if (lastComposed != null) {
+					Release (lastComposed);
+					lastComposed = null;
+				}
+				codec.Dispose ();
+			}
+
+			Clear ();
+		}
+
+		// decoding
+
+		private void DecodeRequests ()
+		{
+			var frameBytes = Info.BytesSize64;
+
+			while (true) {
+				int index;
+				lock (locker) {
+					// stop prefetching when the next frame would not fit
+					if (!isDisposed && requests.Count > 0) {
+						Trim (frameBytes);
+						if (currentBytes + frameBytes > maxBytes) {
+							requests.Clear ();
+							requested.Clear ();
+						}
+					}
+
+					if (isDisposed || requests.Count == 0) {
+						isDecoding = false;
+						return;
+					}
+
+					index = requests.Dequeue ();
+					requested.Remove (index);
+
+					if (entries.ContainsKey (index))
+						continue;
+				}
+
+				try {
+					var entry = DecodeFrame (index);
+					if (entry != null)
+						Release (entry);
+				} catch {
+					// the frame is decoded again on the UI thread when it is needed
+				}
+			}
+		}
+
+		// returns the entry with a lease held for the caller
+		private FrameEntry DecodeFrame (int index)
+		{
+			lock (codecLocker) {
+				if (isDisposed)
+					return null;
+
+				// the frame may have been decoded while waiting for the codec
+				var entry = Acquire (index);
+				if (entry != null)
+					return entry;
+
+				// walk back to the first frame that is cached, or to a frame
+				// that does not depend on any other frame
+				var chain = new Stack<int> ();
+				FrameEntry prior = null;
+				var current = index;
+				while (true) {
+					chain.Push (current);
+
+					var required = frames[current].RequiredFrame;
+					if (required < 0)
+						break;
+
+					prior = lastComposed?.Index == required
+						? Acquire (lastComposed)
+						: Acquire (required);
+					if (prior != null)
+						break;
+
+					current = required;
+				}
+
+				// compose the frames forward from there
+				try {
+					while (chain.Count > 0) {
+						var composed = ComposeFrame (chain.Pop (), prior);
+						if (prior != null)
+							Release (prior);
+						prior = composed;
+
+						if (prior == null)
+							return null;
+					}
+				} catch {
+					if (prior != null)
+						Release (prior);
+					throw;
+				}
+
+				if (lastComposed != null)
+					Release (lastComposed);
+				lastComposed = Acquire (prior);
+
+				return prior;
+			}
+		}
+
+		private FrameEntry ComposeFrame (int index, FrameEntry prior)
+		{
+			using var bitmap = new SKBitmap ();
+			if (!bitmap.TryAllocPixels (Info))
+				return null;
+
+			if (prior != null) {
+				if (!prior.Image.ReadPixels (Info, bitmap.GetPixels (), bitmap.RowBytes))
+					return null;
+			} else {
+				bitmap.Erase (SKColors.Transparent);
+			}
+
+			var options = new SKCodecOptions (index, prior?.Index ?? -1);
+			var result = codec.GetPixels (Info, bitmap.GetPixels (), bitmap.RowBytes, options);
+			Interlocked.Increment (ref decodedFrameCount);
+
+			// a truncated file still has the part of the frame that was there
+			if (result != SKCodecResult.Success && result != SKCodecResult.IncompleteInput)
+				return null;
+
+			bitmap.SetImmutable ();
+			var image = SKImage.FromBitmap (bitmap);
+			if (image == null)
+				return null;
+
+			return Add (index, image);
+		}
+
+		// cache
+
+		private FrameEntry Add (int index, SKImage image)
+		{
+			var entry = new FrameEntry (index, image, image.Info.BytesSize64);
+
+			lock (locker) {
+				// the decoder is the only one that adds, but be safe
+				if (entries.TryGetValue (index, out var existing))
+					Evict (existing.Node, count: false);
+
+				entry.Node = recentlyUsed.AddFirst (entry);
+				entries.Add (index, entry);
+				currentBytes += entry.ByteCount;
+				entry.Leases++;
+
+				Trim (0);
+			}
+
+			return entry;
+		}
+
+		private FrameEntry Acquire (int index)
+		{
+			lock (locker) {
+				if (!entries.TryGetValue (index, out var entry))
+					return null;
+
+				recentlyUsed.Remove (entry.Node);
+				recentlyUsed.AddFirst (entry.Node);
+
+				entry.Leases++;
+				return entry;
+			}
+		}
+
+		private FrameEntry Acquire (FrameEntry entry)
+		{
+			lock (locker) {
+				entry.Leases++;
+				return entry;
+			}
+		}
+
+		internal void Release (FrameEntry entry)
+		{
+			SKImage dispose = null;
+
+			lock (locker) {
+				entry.Leases--;
+				if (entry.IsEvicted && entry.Leases == 0)
+					dispose = entry.TakeImage ();
+				else
+					Trim (0);
+			}
+
+			dispose?.Dispose ();
+		}
+
+		private void Trim (long needed)
+		{
+			// the least recently used frames that are not being shown are
+			// evicted first
+			var node = recentlyUsed.Last;
+			while (currentBytes + needed > maxBytes && node != null) {
+				var previous = node.Previous;
+				if (node.Value.Leases == 0)
+					Evict (node);
+				node = previous;
+			}
+		}
+
+		private void Evict (LinkedListNode<FrameEntry> node, bool count = true)
+		{
+			var entry = node.Value;
+
+			recentlyUsed.Remove (node);
+			entries.Remove (entry.Index);
+
+			entry.IsEvicted = true;
+			currentBytes -= entry.ByteCount;
+
+			if (count)
+				evictionCount++;
+
+			// frames that are still in use are disposed when they are released
+			if (entry.Leases == 0)
+				entry.TakeImage ()?.Dispose ();
+		}
+
+		private static int GetFrameDuration (SKCodecFrameInfo frame) =>
+			frame.Duration <= MinimumFrameDuration ? DefaultFrameDuration : frame.Duration;
+
+		internal sealed class FrameEntry
+		{
+			private SKImage image;
+
+			public FrameEntry (int index, SKImage image, long byteCount)
+			{
+				Index = index;
+				ByteCount = byteCount;
+				this.image = image;
+			}
+
+			public int Index { get; }
+
+			public SKImage Image => image;
+
+			public long ByteCount { get; }
+
+			public int Leases { get; set; }
+
+			public bool IsEvicted { get; set; }
+
+			public LinkedListNode<FrameEntry> Node { get; set; }
+
+			public SKImage TakeImage () =>
+				Interlocked.Exchange (ref image, null);
+		}
+	}
+
+	// A lease on a composed frame of a SKAnimatedImage. The image stays valid
+	// until the lease is disposed, even if the frame is evicted in the meantime.
+	public sealed class SKAnimatedImageFrame : IDisposable
+	{
+		private SKAnimatedImage owner;
+		private SKAnimatedImage.FrameEntry entry;
+
+		internal SKAnimatedImageFrame (SKAnimatedImage owner, SKAnimatedImage.FrameEntry entry)
+		{
+			this.owner = owner;
+			this.entry = entry;
+			Index = entry.Index;
+			Image = entry.Image;
+		}
+
+		public int Index { get; }
+
+		public SKImage Image { get; private set; }
+
+		public void Dispose ()
+		{
+			var o = Interlocked.Exchange (ref owner, null);
+			if (o == null)
+				return;
+
+			o.Release (entry);
+			entry = null;
+			Image = null;
+		}
+	}
+}
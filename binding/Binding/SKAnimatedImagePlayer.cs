@@ -0,0 +1,197 @@
+﻿using System;
+
+namespace SkiaSharp
+{
+	// The playback state of one view of a SKAnimatedImage. The player is meant
+	// to be advanced from the UI thread on every frame: it shows the frame for
+	// the current time if it has already been decoded, and it asks for the
+	// frames after it to be decoded in the background. The very first frame
+	// is decoded on the calling thread so that there is always something to
+	// draw, and so is every frame when the memory cap is too small for the
+	// background decoder to hold a frame next to the one that is shown.
+	public class SKAnimatedImagePlayer : IDisposable
+	{
+		public const int DefaultLookAhead = 3;
+
+		private SKAnimatedImageFrame current;
+		private int lookAhead = DefaultLookAhead;
+
+		// the number of frames since the start of the playback, including
+		// all the loops, of the frame that is shown and the frame that is due
+		private long currentSequence = -1;
+		private long lateSequence = -1;
+
+		internal SKAnimatedImagePlayer (SKAnimatedImage image)
+		{
+			Image = image ?? throw new ArgumentNullException (nameof (image));
+		}
+
+		public SKAnimatedImage Image { get; }
+
+		// the number of frames after the current one that are decoded ahead
+		public int LookAhead {
+			get => lookAhead;
+			set {
+				if (value < 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The look ahead must not be negative.");
+				lookAhead = value;
+			}
+		}
+
+		// the time in the current loop
+		public TimeSpan Position { get; private set; }
+
+		public int CompletedLoops { get; private set; }
+
+		public bool IsCompleted { get; private set; }
+
+		public int CurrentFrameIndex => current?.Index ?? -1;
+
+		// the image stays valid until the player moves to another frame
+		public SKImage CurrentFrame => current?.Image;
+
+		// the number of frames that were shown
+		public long PresentedFrameCount { get; private set; }
+
+		// the number of frames that were never shown because the next frame
+		// was already due by the time they were decoded
+		public long DroppedFrameCount { get; private set; }
+
+		// the number of times that a frame was not decoded when it was due, so
+		// the previous frame was shown for longer
+		public long LateFrameCount { get; private set; }
+
+		public void ResetStatistics ()
+		{
+			PresentedFrameCount = 0;
+			DroppedFrameCount = 0;
+			LateFrameCount = 0;
+		}
+
+		// moves the playback forward, and returns true if the current frame
+		// has changed
+		public bool Advance (TimeSpan elapsed)
+		{
+			if (elapsed < TimeSpan.Zero)
+				throw new ArgumentOutOfRangeException (nameof (elapsed), "The elapsed time must not be negative.");
+
+			if (!IsCompleted)
+				SetPosition (Position + elapsed);
+
+			return Update ();
+		}
+
+		// jumps to the time in the animation, where the time may be longer
+		// than one loop
+		public bool Seek (TimeSpan position)
+		{
+			if (position < TimeSpan.Zero)
+				throw new ArgumentOutOfRangeException (nameof (position), "The position must not be negative.");
+
+			CompletedLoops = 0;
+			IsCompleted = false;
+			currentSequence = -1;
+			lateSequence = -1;
+			SetPosition (position);
+
+			return Update ();
+		}
+
+		public bool Reset () =>
+			Seek (TimeSpan.Zero);
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (disposing) {
+				current?.Dispose ();
+				current = null;
+			}
+		}
+
+		private void SetPosition (TimeSpan position)
+		{
+			var duration = Image.Duration;
+			if (duration <= TimeSpan.Zero) {
+				// a still image
+				Position = TimeSpan.Zero;
+				IsCompleted = true;
+				return;
+			}
+
+			var repetitions = Image.RepetitionCount;
+			if (position >= duration) {
+				var loops = position.Ticks / duration.Ticks;
+				if (repetitions >= 0 && CompletedLoops + loops > repetitions) {
+					// stop on the last frame
+					CompletedLoops = repetitions;
+					Position = duration;
+					IsCompleted = true;
+					return;
+				}
+
+				CompletedLoops += (int)loops;
+				position = TimeSpan.FromTicks (position.Ticks % duration.Ticks);
+			}
+
+			Position = position;
+		}
+
+		private bool Update ()
+		{
+			var frameCount = Image.FrameCount;
+			var index = IsCompleted
+				? frameCount - 1
+				: Image.GetFrameIndex (Position);
+			var sequence = (long)CompletedLoops * frameCount + index;
+
+			var changed = false;
+			if (sequence != currentSequence) {
+				SKAnimatedImageFrame frame;
+				if (!Image.TryGetFrame (index, out frame) && (current == null || !Image.CanPrefetch))
+					frame = Image.GetFrame (index);
+
+				if (frame != null) {
+					if (currentSequence >= 0 && sequence > currentSequence + 1)
+						DroppedFrameCount += sequence - currentSequence - 1;
+
+					current?.Dispose ();
+					current = frame;
+					currentSequence = sequence;
+					PresentedFrameCount++;
+					changed = true;
+				} else if (sequence != lateSequence) {
+					lateSequence = sequence;
+					LateFrameCount++;
+					Image.Prefetch (index);
+				}
+			}
+
+			if (!IsCompleted)
+				PrefetchAfter (index);
+
+			return changed;
+		}
+
+		private void PrefetchAfter (int index)
+		{
+			var frameCount = Image.FrameCount;
+			var loops = Image.RepetitionCount < 0 || CompletedLoops < Image.RepetitionCount;
+
+			for (var i = 1; i <= lookAhead && i < frameCount; i++) {
+				var next = index + i;
+				if (next >= frameCount) {
+					if (!loops)
+						break;
+					next -= frameCount;
+				}
+				Image.Prefetch (next);
+			}
+		}
+	}
+}
@@ -0,0 +1,79 @@
+﻿using System;
+using System.Buffers;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace SkiaSharp
+{
+	// The bodies of the asynchronous decode methods, which cannot live in the
+	// unsafe types that expose them. The encoded bytes are read with
+	// ReadAsync into pooled buffers so that no thread is blocked while the
+	// stream is waiting, and then the decode runs on whichever thread the
+	// last read completed on.
+	internal static class SKAsyncDecoding
+	{
+		public static async Task<SKData> ReadDataAsync (Stream stream, CancellationToken cancellationToken)
+		{
+			var buffer = ArrayPool<byte>.Shared.Rent (SKData.CopyBufferSize);
+			try {
+				if (!stream.CanSeek) {
+					using var memory = new SKDynamicMemoryWStream ();
+					int read;
+					while ((read = await stream.ReadAsync (buffer, 0, buffer.Length, cancellationToken).ConfigureAwait (false)) > 0)
+						memory.Write (buffer, read);
+					return memory.DetachAsData ();
+				}
+
+				// the size is known, so read straight into the data
+				var length = Math.Max (0, stream.Length - stream.Position);
+				var data = SKData.Create (length);
+				try {
+					var address = data.Data;
+					var total = 0L;
+					int read;
+					while (total < length && (read = await stream.ReadAsync (buffer, 0, (int)Math.Min (buffer.Length, length - total), cancellationToken).ConfigureAwait (false)) > 0) {
+						Marshal.Copy (buffer, 0, new IntPtr (address.ToInt64 () + total), read);
+						total += read;
+					}
+
+					if (total == length)
+						return data;
+
+					// the stream ended early
+					var copy = SKData.CreateCopy (address, total);
+					data.Dispose ();
+					return copy;
+				} catch {
+					data.Dispose ();
+					throw;
+				}
+			} finally {
+				ArrayPool<byte>.Shared.Return (buffer);
+			}
+		}
+
+		public static async Task<SKCodec> CreateCodecAsync (Stream stream, CancellationToken cancellationToken)
+		{
+			using var data = await ReadDataAsync (stream, cancellationToken).ConfigureAwait (false);
+			return SKCodec.Create (data);
+		}
+
+		public static async Task<SKImage> FromEncodedDataAsync (Stream stream, CancellationToken cancellationToken)
+		{
+			using var data = await ReadDataAsync (stream, cancellationToken).ConfigureAwait (false);
+			return SKImage.FromEncodedData (data);
+		}
+
+		public static async Task<SKBitmap> DecodeBitmapAsync (Stream stream, SKImageInfo? bitmapInfo, CancellationToken cancellationToken)
+		{
+			using var data = await ReadDataAsync (stream, cancellationToken).ConfigureAwait (false);
+			cancellationToken.ThrowIfCancellationRequested ();
+
+			return bitmapInfo is SKImageInfo info
+				? SKBitmap.Decode (data, info)
+				: SKBitmap.Decode (data);
+		}
+	}
+}
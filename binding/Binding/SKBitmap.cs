@@ -1,6 +1,8 @@
 ﻿using System;
 using System.ComponentModel;
 using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
 
 namespace SkiaSharp
 {
@@ -46,6 +48,9 @@ namespace SkiaSharp
 		private const string UnsupportedColorTypeMessage = "Setting the ColorTable is only supported for bitmaps with ColorTypes of Index8.";
 		private const string UnableToAllocatePixelsMessage = "Unable to allocate pixels for the bitmap.";
 
+		// the size of the pixels that were allocated by the bitmap itself
+		private long nativeBytes;
+
 		internal SKBitmap (IntPtr handle, bool owns)
 			: base (handle, owns)
 		{
@@ -109,8 +114,11 @@ namespace SkiaSharp
 		{
 		}
 
-		protected override void Dispose (bool disposing) =>
+		protected override void Dispose (bool disposing)
+		{
 			base.Dispose (disposing);
+			SKNativeMemory.Release (ref nativeBytes);
+		}
 
 		protected override void DisposeNative () =>
 			SkiaApi.sk_bitmap_destructor (Handle);
@@ -125,20 +133,29 @@ namespace SkiaSharp
 		public bool TryAllocPixels (SKImageInfo info, int rowBytes)
 		{
 			var cinfo = SKImageInfoNative.FromManaged (ref info);
-			return SkiaApi.sk_bitmap_try_alloc_pixels (Handle, &cinfo, (IntPtr)rowBytes);
+			var result = SkiaApi.sk_bitmap_try_alloc_pixels (Handle, &cinfo, (IntPtr)rowBytes);
+			TrackPixels (result);
+			return result;
 		}
 
 		public bool TryAllocPixels (SKImageInfo info, SKBitmapAllocFlags flags)
 		{
 			var cinfo = SKImageInfoNative.FromManaged (ref info);
-			return SkiaApi.sk_bitmap_try_alloc_pixels_with_flags (Handle, &cinfo, (uint)flags);
+			var result = SkiaApi.sk_bitmap_try_alloc_pixels_with_flags (Handle, &cinfo, (uint)flags);
+			TrackPixels (result);
+			return result;
 		}
 
+		// a failed allocation also releases the old pixels
+		private void TrackPixels (bool allocated) =>
+			SKNativeMemory.Track (ref nativeBytes, allocated && OwnsHandle ? (long)RowBytes * Height : 0);
+
 		// Reset
 
 		public void Reset ()
 		{
 			SkiaApi.sk_bitmap_reset (Handle);
+			SKNativeMemory.Release (ref nativeBytes);
 		}
 
 		// SetImmutable
@@ -381,6 +398,7 @@ namespace SkiaSharp
 		public void SetPixels (IntPtr pixels)
 		{
 			SkiaApi.sk_bitmap_set_pixels (Handle, (void*)pixels);
+			SKNativeMemory.Release (ref nativeBytes);
 		}
 
 		[EditorBrowsable (EditorBrowsableState.Never)]
@@ -658,6 +676,30 @@ namespace SkiaSharp
 			}
 		}
 
+		// DecodeAsync
+
+		public static Task<SKBitmap> DecodeAsync (Stream stream) =>
+			DecodeAsync (stream, CancellationToken.None);
+
+		public static Task<SKBitmap> DecodeAsync (Stream stream, CancellationToken cancellationToken)
+		{
+			if (stream == null) {
+				throw new ArgumentNullException (nameof (stream));
+			}
+			return SKAsyncDecoding.DecodeBitmapAsync (stream, null, cancellationToken);
+		}
+
+		public static Task<SKBitmap> DecodeAsync (Stream stream, SKImageInfo bitmapInfo) =>
+			DecodeAsync (stream, bitmapInfo, CancellationToken.None);
+
+		public static Task<SKBitmap> DecodeAsync (Stream stream, SKImageInfo bitmapInfo, CancellationToken cancellationToken)
+		{
+			if (stream == null) {
+				throw new ArgumentNullException (nameof (stream));
+			}
+			return SKAsyncDecoding.DecodeBitmapAsync (stream, bitmapInfo, cancellationToken);
+		}
+
 		public static SKBitmap Decode (byte[] buffer) =>
 			Decode (buffer.AsSpan ());
 
@@ -720,19 +762,25 @@ namespace SkiaSharp
 				? new SKBitmapReleaseDelegate ((addr, _) => releaseProc (addr, context))
 				: releaseProc;
 			var proxy = DelegateProxies.Create (del, DelegateProxies.SKBitmapReleaseDelegateProxy, out _, out var ctx);
-			return SkiaApi.sk_bitmap_install_pixels (Handle, &cinfo, (void*)pixels, (IntPtr)rowBytes, proxy, (void*)ctx);
+			var result = SkiaApi.sk_bitmap_install_pixels (Handle, &cinfo, (void*)pixels, (IntPtr)rowBytes, proxy, (void*)ctx);
+			SKNativeMemory.Release (ref nativeBytes);
+			return result;
 		}
 
 		public bool InstallPixels (SKPixmap pixmap)
 		{
-			return SkiaApi.sk_bitmap_install_pixels_with_pixmap (Handle, pixmap.Handle);
+			var result = SkiaApi.sk_bitmap_install_pixels_with_pixmap (Handle, pixmap.Handle);
+			SKNativeMemory.Release (ref nativeBytes);
+			return result;
 		}
 
 		// InstallMaskPixels
 
 		public bool InstallMaskPixels (SKMask mask)
 		{
-			return SkiaApi.sk_bitmap_install_mask_pixels (Handle, &mask);
+			var result = SkiaApi.sk_bitmap_install_mask_pixels (Handle, &mask);
+			SKNativeMemory.Release (ref nativeBytes);
+			return result;
 		}
 
 		// NotifyPixelsChanged
@@ -852,7 +900,7 @@ namespace SkiaSharp
 
 		public bool Encode (Stream dst, SKEncodedImageFormat format, int quality)
 		{
-			using var wrapped = new SKManagedWStream (dst);
+			using var wrapped = new SKManagedWStream (dst, false, SKManagedWStream.DefaultBufferSize);
 			return Encode (wrapped, format, quality);
 		}
 
@@ -870,6 +918,11 @@ namespace SkiaSharp
 		private void Swap (SKBitmap other)
 		{
 			SkiaApi.sk_bitmap_swap (Handle, other.Handle);
+
+			// the pixels moved, but the total did not change
+			var bytes = nativeBytes;
+			nativeBytes = other.nativeBytes;
+			other.nativeBytes = bytes;
 		}
 
 		// ToShader
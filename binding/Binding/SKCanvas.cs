@@ -23,16 +23,25 @@ namespace SkiaSharp
 			if (bitmap == null)
 				throw new ArgumentNullException (nameof (bitmap));
 			Handle = SkiaApi.sk_canvas_new_from_bitmap (bitmap.Handle);
+			DrawsToPixels = true;
 		}
 
+		// true for the canvases of bitmaps and surfaces, as opposed to the
+		// canvases that record the drawing, such as the ones of pictures,
+		// documents and SVGs, which must not get rasterized drawables
+		internal bool DrawsToPixels { get; set; }
+
 		protected override void Dispose (bool disposing) =>
 			base.Dispose (disposing);
 
 		protected override void DisposeNative () =>
 			SkiaApi.sk_canvas_destroy (Handle);
 
-		public void Discard () =>
+		public void Discard ()
+		{
+			using var scope = Profile (SKCanvasOperation.Discard);
 			SkiaApi.sk_canvas_discard (Handle);
+		}
 
 		// QuickReject
 
@@ -54,16 +63,19 @@ namespace SkiaSharp
 		{
 			if (Handle == IntPtr.Zero)
 				throw new ObjectDisposedException ("SKCanvas");
+			using var scope = Profile (SKCanvasOperation.Save);
 			return SkiaApi.sk_canvas_save (Handle);
 		}
 
 		public int SaveLayer (SKRect limit, SKPaint paint)
 		{
+			using var scope = Profile (SKCanvasOperation.SaveLayer, paint);
 			return SkiaApi.sk_canvas_save_layer (Handle, &limit, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
 		public int SaveLayer (SKPaint paint)
 		{
+			using var scope = Profile (SKCanvasOperation.SaveLayer, paint);
 			return SkiaApi.sk_canvas_save_layer (Handle, null, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
@@ -72,11 +84,17 @@ namespace SkiaSharp
 
 		// DrawColor
 
-		public void DrawColor (SKColor color, SKBlendMode mode = SKBlendMode.Src) =>
+		public void DrawColor (SKColor color, SKBlendMode mode = SKBlendMode.Src)
+		{
+			using var scope = Profile (SKCanvasOperation.DrawColor);
 			SkiaApi.sk_canvas_draw_color (Handle, (uint)color, mode);
+		}
 
-		public void DrawColor (SKColorF color, SKBlendMode mode = SKBlendMode.Src) =>
+		public void DrawColor (SKColorF color, SKBlendMode mode = SKBlendMode.Src)
+		{
+			using var scope = Profile (SKCanvasOperation.DrawColor);
 			SkiaApi.sk_canvas_draw_color4f (Handle, color, mode);
+		}
 
 		// DrawLine
 
@@ -89,6 +107,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawLine, paint);
 			SkiaApi.sk_canvas_draw_line (Handle, x0, y0, x1, y1, paint.Handle);
 		}
 
@@ -97,21 +116,29 @@ namespace SkiaSharp
 		public void Clear () =>
 			Clear (SKColors.Empty);
 
-		public void Clear (SKColor color) =>
+		public void Clear (SKColor color)
+		{
+			using var scope = Profile (SKCanvasOperation.Clear);
 			SkiaApi.sk_canvas_clear (Handle, (uint)color);
+		}
 
-		public void Clear (SKColorF color) =>
+		public void Clear (SKColorF color)
+		{
+			using var scope = Profile (SKCanvasOperation.Clear);
 			SkiaApi.sk_canvas_clear_color4f (Handle, color);
+		}
 
 		// Restore*
 
 		public void Restore ()
 		{
+			using var scope = Profile (SKCanvasOperation.Restore);
 			SkiaApi.sk_canvas_restore (Handle);
 		}
 
 		public void RestoreToCount (int count)
 		{
+			using var scope = Profile (SKCanvasOperation.RestoreToCount);
 			SkiaApi.sk_canvas_restore_to_count (Handle, count);
 		}
 
@@ -122,6 +149,7 @@ namespace SkiaSharp
 			if (dx == 0 && dy == 0)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Translate);
 			SkiaApi.sk_canvas_translate (Handle, dx, dy);
 		}
 
@@ -130,6 +158,7 @@ namespace SkiaSharp
 			if (point.IsEmpty)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Translate);
 			SkiaApi.sk_canvas_translate (Handle, point.X, point.Y);
 		}
 
@@ -140,6 +169,7 @@ namespace SkiaSharp
 			if (s == 1)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Scale);
 			SkiaApi.sk_canvas_scale (Handle, s, s);
 		}
 
@@ -148,6 +178,7 @@ namespace SkiaSharp
 			if (sx == 1 && sy == 1)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Scale);
 			SkiaApi.sk_canvas_scale (Handle, sx, sy);
 		}
 
@@ -156,6 +187,7 @@ namespace SkiaSharp
 			if (size.IsEmpty)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Scale);
 			SkiaApi.sk_canvas_scale (Handle, size.X, size.Y);
 		}
 
@@ -164,6 +196,7 @@ namespace SkiaSharp
 			if (sx == 1 && sy == 1)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Scale);
 			Translate (px, py);
 			Scale (sx, sy);
 			Translate (-px, -py);
@@ -176,6 +209,7 @@ namespace SkiaSharp
 			if (degrees % DegreesCircle == 0)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Rotate);
 			SkiaApi.sk_canvas_rotate_degrees (Handle, degrees);
 		}
 
@@ -184,6 +218,7 @@ namespace SkiaSharp
 			if (radians % RadiansCircle == 0)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Rotate);
 			SkiaApi.sk_canvas_rotate_radians (Handle, radians);
 		}
 
@@ -192,6 +227,7 @@ namespace SkiaSharp
 			if (degrees % DegreesCircle == 0)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Rotate);
 			Translate (px, py);
 			RotateDegrees (degrees);
 			Translate (-px, -py);
@@ -202,6 +238,7 @@ namespace SkiaSharp
 			if (radians % RadiansCircle == 0)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Rotate);
 			Translate (px, py);
 			RotateRadians (radians);
 			Translate (-px, -py);
@@ -214,6 +251,7 @@ namespace SkiaSharp
 			if (sx == 0 && sy == 0)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Skew);
 			SkiaApi.sk_canvas_skew (Handle, sx, sy);
 		}
 
@@ -222,6 +260,7 @@ namespace SkiaSharp
 			if (skew.IsEmpty)
 				return;
 
+			using var scope = Profile (SKCanvasOperation.Skew);
 			SkiaApi.sk_canvas_skew (Handle, skew.X, skew.Y);
 		}
 
@@ -230,6 +269,7 @@ namespace SkiaSharp
 		public void Concat (ref SKMatrix m)
 		{
 			fixed (SKMatrix* ptr = &m) {
+				using var scope = Profile (SKCanvasOperation.Concat);
 				SkiaApi.sk_canvas_concat (Handle, ptr);
 			}
 		}
@@ -238,6 +278,7 @@ namespace SkiaSharp
 
 		public void ClipRect (SKRect rect, SKClipOperation operation = SKClipOperation.Intersect, bool antialias = false)
 		{
+			using var scope = Profile (SKCanvasOperation.ClipRect);
 			SkiaApi.sk_canvas_clip_rect_with_operation (Handle, &rect, operation, antialias);
 		}
 
@@ -246,6 +287,7 @@ namespace SkiaSharp
 			if (rect == null)
 				throw new ArgumentNullException (nameof (rect));
 
+			using var scope = Profile (SKCanvasOperation.ClipRoundRect);
 			SkiaApi.sk_canvas_clip_rrect_with_operation (Handle, rect.Handle, operation, antialias);
 		}
 
@@ -254,6 +296,7 @@ namespace SkiaSharp
 			if (path == null)
 				throw new ArgumentNullException (nameof (path));
 
+			using var scope = Profile (SKCanvasOperation.ClipPath);
 			SkiaApi.sk_canvas_clip_path_with_operation (Handle, path.Handle, operation, antialias);
 		}
 
@@ -262,6 +305,7 @@ namespace SkiaSharp
 			if (region == null)
 				throw new ArgumentNullException (nameof (region));
 
+			using var scope = Profile (SKCanvasOperation.ClipRegion);
 			SkiaApi.sk_canvas_clip_region (Handle, region.Handle, operation);
 		}
 
@@ -303,6 +347,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawPaint, paint);
 			SkiaApi.sk_canvas_draw_paint (Handle, paint.Handle);
 		}
 
@@ -314,6 +359,7 @@ namespace SkiaSharp
 				throw new ArgumentNullException (nameof (region));
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawRegion, paint);
 			SkiaApi.sk_canvas_draw_region (Handle, region.Handle, paint.Handle);
 		}
 
@@ -328,6 +374,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawRect, paint);
 			SkiaApi.sk_canvas_draw_rect (Handle, &rect, paint.Handle);
 		}
 
@@ -339,6 +386,7 @@ namespace SkiaSharp
 				throw new ArgumentNullException (nameof (rect));
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawRoundRect, paint);
 			SkiaApi.sk_canvas_draw_rrect (Handle, rect.Handle, paint.Handle);
 		}
 
@@ -351,6 +399,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawRoundRect, paint);
 			SkiaApi.sk_canvas_draw_round_rect (Handle, &rect, rx, ry, paint.Handle);
 		}
 
@@ -375,6 +424,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawOval, paint);
 			SkiaApi.sk_canvas_draw_oval (Handle, &rect, paint.Handle);
 		}
 
@@ -384,6 +434,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawCircle, paint);
 			SkiaApi.sk_canvas_draw_circle (Handle, cx, cy, radius, paint.Handle);
 		}
 
@@ -400,6 +451,7 @@ namespace SkiaSharp
 				throw new ArgumentNullException (nameof (paint));
 			if (path == null)
 				throw new ArgumentNullException (nameof (path));
+			using var scope = Profile (SKCanvasOperation.DrawPath, paint);
 			SkiaApi.sk_canvas_draw_path (Handle, path.Handle, paint.Handle);
 		}
 
@@ -412,6 +464,7 @@ namespace SkiaSharp
 			if (points == null)
 				throw new ArgumentNullException (nameof (points));
 			fixed (SKPoint* p = points) {
+				using var scope = Profile (SKCanvasOperation.DrawPoints, paint);
 				SkiaApi.sk_canvas_draw_points (Handle, mode, (IntPtr)points.Length, p, paint.Handle);
 			}
 		}
@@ -427,6 +480,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawPoint, paint);
 			SkiaApi.sk_canvas_draw_point (Handle, x, y, paint.Handle);
 		}
 
@@ -437,6 +491,7 @@ namespace SkiaSharp
 
 		public void DrawPoint (float x, float y, SKColor color)
 		{
+			using var scope = Profile (SKCanvasOperation.DrawPoint);
 			using (var paint = new SKPaint { Color = color, BlendMode = SKBlendMode.Src }) {
 				DrawPoint (x, y, paint);
 			}
@@ -453,6 +508,7 @@ namespace SkiaSharp
 		{
 			if (image == null)
 				throw new ArgumentNullException (nameof (image));
+			using var scope = Profile (SKCanvasOperation.DrawImage, paint);
 			SkiaApi.sk_canvas_draw_image (Handle, image.Handle, x, y, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
@@ -460,6 +516,7 @@ namespace SkiaSharp
 		{
 			if (image == null)
 				throw new ArgumentNullException (nameof (image));
+			using var scope = Profile (SKCanvasOperation.DrawImage, paint);
 			SkiaApi.sk_canvas_draw_image_rect (Handle, image.Handle, null, &dest, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
@@ -467,6 +524,7 @@ namespace SkiaSharp
 		{
 			if (image == null)
 				throw new ArgumentNullException (nameof (image));
+			using var scope = Profile (SKCanvasOperation.DrawImage, paint);
 			SkiaApi.sk_canvas_draw_image_rect (Handle, image.Handle, &source, &dest, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
@@ -488,6 +546,7 @@ namespace SkiaSharp
 			if (picture == null)
 				throw new ArgumentNullException (nameof (picture));
 			fixed (SKMatrix* m = &matrix) {
+				using var scope = Profile (SKCanvasOperation.DrawPicture, paint);
 				SkiaApi.sk_canvas_draw_picture (Handle, picture.Handle, m, paint == null ? IntPtr.Zero : paint.Handle);
 			}
 		}
@@ -496,6 +555,7 @@ namespace SkiaSharp
 		{
 			if (picture == null)
 				throw new ArgumentNullException (nameof (picture));
+			using var scope = Profile (SKCanvasOperation.DrawPicture, paint);
 			SkiaApi.sk_canvas_draw_picture (Handle, picture.Handle, null, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
@@ -505,6 +565,9 @@ namespace SkiaSharp
 		{
 			if (drawable == null)
 				throw new ArgumentNullException (nameof (drawable));
+			using var scope = Profile (SKCanvasOperation.DrawDrawable);
+			if (drawable.IsRasterCacheEnabled && SKDrawableCache.TryDraw (drawable, this, matrix))
+				return;
 			fixed (SKMatrix* m = &matrix) {
 				SkiaApi.sk_canvas_draw_drawable (Handle, drawable.Handle, m);
 			}
@@ -533,18 +596,30 @@ namespace SkiaSharp
 
 		public void DrawBitmap (SKBitmap bitmap, float x, float y, SKPaint paint = null)
 		{
+			if (bitmap == null)
+				throw new ArgumentNullException (nameof (bitmap));
+
+			using var scope = Profile (SKCanvasOperation.DrawBitmap, paint);
 			using var image = SKImage.FromBitmap (bitmap);
 			DrawImage (image, x, y, paint);
 		}
 
 		public void DrawBitmap (SKBitmap bitmap, SKRect dest, SKPaint paint = null)
 		{
+			if (bitmap == null)
+				throw new ArgumentNullException (nameof (bitmap));
+
+			using var scope = Profile (SKCanvasOperation.DrawBitmap, paint);
 			using var image = SKImage.FromBitmap (bitmap);
 			DrawImage (image, dest, paint);
 		}
 
 		public void DrawBitmap (SKBitmap bitmap, SKRect source, SKRect dest, SKPaint paint = null)
 		{
+			if (bitmap == null)
+				throw new ArgumentNullException (nameof (bitmap));
+
+			using var scope = Profile (SKCanvasOperation.DrawBitmap, paint);
 			using var image = SKImage.FromBitmap (bitmap);
 			DrawImage (image, source, dest, paint);
 		}
@@ -561,6 +636,7 @@ namespace SkiaSharp
 			if (surface == null)
 				throw new ArgumentNullException (nameof (surface));
 
+			using var scope = Profile (SKCanvasOperation.DrawSurface, paint);
 			surface.Draw (this, x, y, paint);
 		}
 
@@ -573,11 +649,16 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawTextBlob, paint);
 			SkiaApi.sk_canvas_draw_text_blob (Handle, text.Handle, x, y, paint.Handle);
 		}
 
 		// DrawText
 
+		// when set, the string overloads reuse the blobs from this cache
+		// instead of creating a new blob for every call
+		public SKTextBlobCache TextBlobCache { get; set; }
+
 		public void DrawText (string text, SKPoint p, SKPaint paint)
 		{
 			DrawText (text, p.X, p.Y, paint);
@@ -597,6 +678,21 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawText, paint);
+			var cache = TextBlobCache;
+			if (cache != null) {
+				var align = paint.TextAlign;
+				var cached = cache.GetTextBlob (text, font, align != SKTextAlign.Left, out var cachedWidth);
+				if (cached == null)
+					return;
+
+				if (align != SKTextAlign.Left)
+					x -= align == SKTextAlign.Center ? cachedWidth * 0.5f : cachedWidth;
+
+				DrawText (cached, x, y, paint);
+				return;
+			}
+
 			if (paint.TextAlign != SKTextAlign.Left) {
 				var width = font.MeasureText (text);
 				if (paint.TextAlign == SKTextAlign.Center)
@@ -627,6 +723,7 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawText, paint);
 			if (paint.TextAlign != SKTextAlign.Left) {
 				var width = paint.MeasureText (text);
 				if (paint.TextAlign == SKTextAlign.Center)
@@ -657,6 +754,7 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawText, paint);
 			if (paint.TextAlign != SKTextAlign.Left) {
 				var width = paint.MeasureText (buffer, length);
 				if (paint.TextAlign == SKTextAlign.Center)
@@ -684,6 +782,7 @@ namespace SkiaSharp
 			if (points == null)
 				throw new ArgumentNullException (nameof (points));
 
+			using var scope = Profile (SKCanvasOperation.DrawText, paint);
 			using var blob = SKTextBlob.CreatePositioned (text, paint.GetFont (), points);
 			if (blob == null)
 				return;
@@ -702,6 +801,7 @@ namespace SkiaSharp
 			if (points == null)
 				throw new ArgumentNullException (nameof (points));
 
+			using var scope = Profile (SKCanvasOperation.DrawText, paint);
 			using var blob = SKTextBlob.CreatePositioned (text, paint.TextEncoding, paint.GetFont (), points);
 			if (blob == null)
 				return;
@@ -720,6 +820,7 @@ namespace SkiaSharp
 			if (points == null)
 				throw new ArgumentNullException (nameof (points));
 
+			using var scope = Profile (SKCanvasOperation.DrawText, paint);
 			using var blob = SKTextBlob.CreatePositioned (buffer, length, paint.TextEncoding, paint.GetFont (), points);
 			if (blob == null)
 				return;
@@ -758,6 +859,7 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawTextOnPath, paint);
 			if (warpGlyphs) {
 				using var textPath = font.GetTextPathOnPath (text, path, paint.TextAlign, offset);
 				DrawPath (textPath, paint);
@@ -809,6 +911,7 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawTextOnPath, paint);
 			var font = paint.GetFont ();
 
 			using var textPath = font.GetTextPathOnPath (buffer, length, paint.TextEncoding, path, paint.TextAlign, new SKPoint (hOffset, vOffset));
@@ -819,6 +922,7 @@ namespace SkiaSharp
 
 		public void Flush ()
 		{
+			using var scope = Profile (SKCanvasOperation.Flush);
 			SkiaApi.sk_canvas_flush (Handle);
 		}
 
@@ -828,12 +932,14 @@ namespace SkiaSharp
 		{
 			var bytes = StringUtilities.GetEncodedText (key, SKTextEncoding.Utf8, true);
 			fixed (byte* b = bytes) {
+				using var scope = Profile (SKCanvasOperation.DrawAnnotation);
 				SkiaApi.sk_canvas_draw_annotation (base.Handle, &rect, b, value == null ? IntPtr.Zero : value.Handle);
 			}
 		}
 
 		public void DrawUrlAnnotation (SKRect rect, SKData value)
 		{
+			using var scope = Profile (SKCanvasOperation.DrawAnnotation);
 			SkiaApi.sk_canvas_draw_url_annotation (Handle, &rect, value == null ? IntPtr.Zero : value.Handle);
 		}
 
@@ -846,6 +952,7 @@ namespace SkiaSharp
 
 		public void DrawNamedDestinationAnnotation (SKPoint point, SKData value)
 		{
+			using var scope = Profile (SKCanvasOperation.DrawAnnotation);
 			SkiaApi.sk_canvas_draw_named_destination_annotation (Handle, &point, value == null ? IntPtr.Zero : value.Handle);
 		}
 
@@ -858,6 +965,7 @@ namespace SkiaSharp
 
 		public void DrawLinkDestinationAnnotation (SKRect rect, SKData value)
 		{
+			using var scope = Profile (SKCanvasOperation.DrawAnnotation);
 			SkiaApi.sk_canvas_draw_link_destination_annotation (Handle, &rect, value == null ? IntPtr.Zero : value.Handle);
 		}
 
@@ -872,6 +980,10 @@ namespace SkiaSharp
 
 		public void DrawBitmapNinePatch (SKBitmap bitmap, SKRectI center, SKRect dst, SKPaint paint = null)
 		{
+			if (bitmap == null)
+				throw new ArgumentNullException (nameof (bitmap));
+
+			using var scope = Profile (SKCanvasOperation.DrawImageNinePatch, paint);
 			using var image = SKImage.FromBitmap (bitmap);
 			DrawImageNinePatch (image, center, dst, paint);
 		}
@@ -884,6 +996,7 @@ namespace SkiaSharp
 			if (!SKRect.Create (image.Width, image.Height).Contains (center))
 				throw new ArgumentException ("Center rectangle must be contained inside the image bounds.", nameof (center));
 
+			using var scope = Profile (SKCanvasOperation.DrawImageNinePatch, paint);
 			SkiaApi.sk_canvas_draw_image_nine (Handle, image.Handle, &center, &dst, paint == null ? IntPtr.Zero : paint.Handle);
 		}
 
@@ -891,6 +1004,10 @@ namespace SkiaSharp
 
 		public void DrawBitmapLattice (SKBitmap bitmap, int[] xDivs, int[] yDivs, SKRect dst, SKPaint paint = null)
 		{
+			if (bitmap == null)
+				throw new ArgumentNullException (nameof (bitmap));
+
+			using var scope = Profile (SKCanvasOperation.DrawImageLattice, paint);
 			using var image = SKImage.FromBitmap (bitmap);
 			DrawImageLattice (image, xDivs, yDivs, dst, paint);
 		}
@@ -906,6 +1023,10 @@ namespace SkiaSharp
 
 		public void DrawBitmapLattice (SKBitmap bitmap, SKLattice lattice, SKRect dst, SKPaint paint = null)
 		{
+			if (bitmap == null)
+				throw new ArgumentNullException (nameof (bitmap));
+
+			using var scope = Profile (SKCanvasOperation.DrawImageLattice, paint);
 			using var image = SKImage.FromBitmap (bitmap);
 			DrawImageLattice (image, lattice, dst, paint);
 		}
@@ -936,6 +1057,7 @@ namespace SkiaSharp
 					var bounds = lattice.Bounds.Value;
 					nativeLattice.fBounds = &bounds;
 				}
+				using var scope = Profile (SKCanvasOperation.DrawImageLattice, paint);
 				SkiaApi.sk_canvas_draw_image_lattice (Handle, image.Handle, &nativeLattice, &dst, paint == null ? IntPtr.Zero : paint.Handle);
 			}
 		}
@@ -944,11 +1066,13 @@ namespace SkiaSharp
 
 		public void ResetMatrix ()
 		{
+			using var scope = Profile (SKCanvasOperation.ResetMatrix);
 			SkiaApi.sk_canvas_reset_matrix (Handle);
 		}
 
 		public void SetMatrix (SKMatrix matrix)
 		{
+			using var scope = Profile (SKCanvasOperation.SetMatrix);
 			SkiaApi.sk_canvas_set_matrix (Handle, &matrix);
 		}
 
@@ -968,24 +1092,48 @@ namespace SkiaSharp
 
 		public void DrawVertices (SKVertexMode vmode, SKPoint[] vertices, SKColor[] colors, SKPaint paint)
 		{
+			if (vertices == null)
+				throw new ArgumentNullException (nameof (vertices));
+			if (paint == null)
+				throw new ArgumentNullException (nameof (paint));
+
+			using var scope = Profile (SKCanvasOperation.DrawVertices, paint);
 			var vert = SKVertices.CreateCopy (vmode, vertices, colors);
 			DrawVertices (vert, SKBlendMode.Modulate, paint);
 		}
 
 		public void DrawVertices (SKVertexMode vmode, SKPoint[] vertices, SKPoint[] texs, SKColor[] colors, SKPaint paint)
 		{
+			if (vertices == null)
+				throw new ArgumentNullException (nameof (vertices));
+			if (paint == null)
+				throw new ArgumentNullException (nameof (paint));
+
+			using var scope = Profile (SKCanvasOperation.DrawVertices, paint);
 			var vert = SKVertices.CreateCopy (vmode, vertices, texs, colors);
 			DrawVertices (vert, SKBlendMode.Modulate, paint);
 		}
 
 		public void DrawVertices (SKVertexMode vmode, SKPoint[] vertices, SKPoint[] texs, SKColor[] colors, UInt16[] indices, SKPaint paint)
 		{
+			if (vertices == null)
+				throw new ArgumentNullException (nameof (vertices));
+			if (paint == null)
+				throw new ArgumentNullException (nameof (paint));
+
+			using var scope = Profile (SKCanvasOperation.DrawVertices, paint);
 			var vert = SKVertices.CreateCopy (vmode, vertices, texs, colors, indices);
 			DrawVertices (vert, SKBlendMode.Modulate, paint);
 		}
 
 		public void DrawVertices (SKVertexMode vmode, SKPoint[] vertices, SKPoint[] texs, SKColor[] colors, SKBlendMode mode, UInt16[] indices, SKPaint paint)
 		{
+			if (vertices == null)
+				throw new ArgumentNullException (nameof (vertices));
+			if (paint == null)
+				throw new ArgumentNullException (nameof (paint));
+
+			using var scope = Profile (SKCanvasOperation.DrawVertices, paint);
 			var vert = SKVertices.CreateCopy (vmode, vertices, texs, colors, indices);
 			DrawVertices (vert, mode, paint);
 		}
@@ -996,6 +1144,7 @@ namespace SkiaSharp
 				throw new ArgumentNullException (nameof (vertices));
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawVertices, paint);
 			SkiaApi.sk_canvas_draw_vertices (Handle, vertices.Handle, mode, paint.Handle);
 		}
 
@@ -1005,6 +1154,7 @@ namespace SkiaSharp
 		{
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
+			using var scope = Profile (SKCanvasOperation.DrawArc, paint);
 			SkiaApi.sk_canvas_draw_arc (Handle, &oval, startAngle, sweepAngle, useCenter, paint.Handle);
 		}
 
@@ -1019,6 +1169,7 @@ namespace SkiaSharp
 			if (paint == null)
 				throw new ArgumentNullException (nameof (paint));
 
+			using var scope = Profile (SKCanvasOperation.DrawRoundRectDifference, paint);
 			SkiaApi.sk_canvas_draw_drrect (Handle, outer.Handle, inner.Handle, paint.Handle);
 		}
 
@@ -1042,15 +1193,30 @@ namespace SkiaSharp
 			if (transforms == null)
 				throw new ArgumentNullException (nameof (transforms));
 
+			DrawAtlas (atlas, (ReadOnlySpan<SKRect>)sprites, transforms, colors, mode, cullRect, paint);
+		}
+
+		public void DrawAtlas (SKImage atlas, ReadOnlySpan<SKRect> sprites, ReadOnlySpan<SKRotationScaleMatrix> transforms, ReadOnlySpan<SKColor> colors, SKBlendMode mode, SKPaint paint) =>
+			DrawAtlas (atlas, sprites, transforms, colors, mode, null, paint);
+
+		public void DrawAtlas (SKImage atlas, ReadOnlySpan<SKRect> sprites, ReadOnlySpan<SKRotationScaleMatrix> transforms, ReadOnlySpan<SKColor> colors, SKBlendMode mode, SKRect cullRect, SKPaint paint) =>
+			DrawAtlas (atlas, sprites, transforms, colors, mode, &cullRect, paint);
+
+		private void DrawAtlas (SKImage atlas, ReadOnlySpan<SKRect> sprites, ReadOnlySpan<SKRotationScaleMatrix> transforms, ReadOnlySpan<SKColor> colors, SKBlendMode mode, SKRect* cullRect, SKPaint paint)
+		{
+			if (atlas == null)
+				throw new ArgumentNullException (nameof (atlas));
+
 			if (transforms.Length != sprites.Length)
 				throw new ArgumentException ("The number of transforms must match the number of sprites.", nameof (transforms));
-			if (colors != null && colors.Length != sprites.Length)
+			if (colors.Length != 0 && colors.Length != sprites.Length)
 				throw new ArgumentException ("The number of colors must match the number of sprites.", nameof (colors));
 
 			fixed (SKRect* s = sprites)
 			fixed (SKRotationScaleMatrix* t = transforms)
 			fixed (SKColor* c = colors) {
-				SkiaApi.sk_canvas_draw_atlas (Handle, atlas.Handle, t, s, (uint*)c, transforms.Length, mode, cullRect, paint.Handle);
+				using var scope = Profile (SKCanvasOperation.DrawAtlas, paint);
+				SkiaApi.sk_canvas_draw_atlas (Handle, atlas.Handle, t, s, (uint*)c, transforms.Length, mode, cullRect, paint?.Handle ?? IntPtr.Zero);
 			}
 		}
 
@@ -1078,10 +1244,18 @@ namespace SkiaSharp
 			fixed (SKPoint* cubes = cubics)
 			fixed (SKColor* cols = colors)
 			fixed (SKPoint* coords = texCoords) {
+				using var scope = Profile (SKCanvasOperation.DrawPatch, paint);
 				SkiaApi.sk_canvas_draw_patch (Handle, cubes, (uint*)cols, coords, mode, paint.Handle);
 			}
 		}
 
+		// Profile
+
+		// this is a no-op unless the canvas is a SKProfilingCanvas, nested
+		// calls (DrawText -> DrawTextBlob) are attributed to the outer call
+		private SKCanvasProfilingScope Profile (SKCanvasOperation operation, SKPaint paint = null) =>
+			this is SKProfilingCanvas profiling ? profiling.BeginOperation (operation, paint) : default;
+
 		internal static SKCanvas GetObject (IntPtr handle, bool owns = true, bool unrefExisting = true) =>
 			GetOrAddObject (handle, owns, unrefExisting, (h, o) => new SKCanvas (h, o));
 	}
@@ -1,6 +1,8 @@
 ﻿using System;
 using System.ComponentModel;
 using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
 
 namespace SkiaSharp
 {
@@ -316,6 +318,19 @@ namespace SkiaSharp
 			}
 		}
 
+		// create (async)
+
+		public static Task<SKCodec> CreateAsync (Stream stream) =>
+			CreateAsync (stream, CancellationToken.None);
+
+		public static Task<SKCodec> CreateAsync (Stream stream, CancellationToken cancellationToken)
+		{
+			if (stream == null)
+				throw new ArgumentNullException (nameof (stream));
+
+			return SKAsyncDecoding.CreateCodecAsync (stream, cancellationToken);
+		}
+
 		// create (data)
 
 		public static SKCodec Create (SKData data)
@@ -0,0 +1,93 @@
+﻿using System;
+using System.Threading;
+
+namespace SkiaSharp
+{
+	// Converts pixels from one color space and pixel format to another, such
+	// as from Display P3 to sRGB or from 8888 to linear F16. The pixmaps are
+	// split into bands of rows, and each band is converted by the native
+	// ReadPixels on its own thread, so the result is exactly what a single
+	// ReadPixels would give.
+	//
+	// Nothing is kept between the calls: the native API does not expose the
+	// transform that ReadPixels builds from the color spaces, so every band
+	// builds its own.
+	public static class SKColorConverter
+	{
+		// the rows of a band must be at least this many bytes to be worth a
+		// thread, and small images are not split at all
+		private const int MinimumBandBytes = 64 * 1024;
+		private const long MinimumParallelBytes = 1024 * 1024;
+
+		// more bands than threads so that a slow thread does not hold up the rest
+		private const int BandsPerThread = 4;
+
+		public static bool Convert (SKPixmap source, SKPixmap destination) =>
+			Convert (source, destination, 0);
+
+		// the pixmaps must be the same size, and zero uses all the processors
+		public static bool Convert (SKPixmap source, SKPixmap destination, int maxDegreeOfParallelism)
+		{
+			if (source == null)
+				throw new ArgumentNullException (nameof (source));
+			if (destination == null)
+				throw new ArgumentNullException (nameof (destination));
+			if (maxDegreeOfParallelism < 0)
+				throw new ArgumentOutOfRangeException (nameof (maxDegreeOfParallelism));
+
+			var sourceInfo = source.Info;
+			var destinationInfo = destination.Info;
+
+			if (sourceInfo.Width != destinationInfo.Width || sourceInfo.Height != destinationInfo.Height)
+				throw new ArgumentException ("The destination pixmap must be the same size as the source pixmap.", nameof (destination));
+
+			var width = destinationInfo.Width;
+			var height = destinationInfo.Height;
+			var pixels = destination.GetPixels ();
+			var rowBytes = destination.RowBytes;
+
+			if (width <= 0 || height <= 0 || pixels == IntPtr.Zero)
+				return false;
+			if (sourceInfo.ColorType == SKColorType.Unknown || destinationInfo.ColorType == SKColorType.Unknown)
+				return false;
+
+			if (maxDegreeOfParallelism == 0)
+				maxDegreeOfParallelism = Environment.ProcessorCount;
+
+			var bandRowBytes = Math.Max (sourceInfo.RowBytes, destinationInfo.RowBytes);
+			var bandRows = GetBandRows (height, bandRowBytes, maxDegreeOfParallelism);
+
+			// every band builds the transform again, so a single band is done
+			// with a single call on this thread
+			if (bandRows >= height)
+				return source.ReadPixels (destinationInfo, pixels, rowBytes, 0, 0);
+
+			var bandCount = (height + bandRows - 1) / bandRows;
+
+			var failed = 0;
+			Utils.ParallelFor (bandCount, maxDegreeOfParallelism, b => {
+				var y = b * bandRows;
+				var rows = Math.Min (bandRows, height - y);
+
+				var bandInfo = destinationInfo.WithSize (width, rows);
+				var bandPixels = new IntPtr (pixels.ToInt64 () + (long)y * rowBytes);
+				if (!source.ReadPixels (bandInfo, bandPixels, rowBytes, 0, y))
+					Interlocked.Exchange (ref failed, 1);
+			});
+
+			return failed == 0;
+		}
+
+		// the number of rows in each band, which is the whole height when the
+		// image is converted on one thread
+		internal static int GetBandRows (int height, int bandRowBytes, int maxDegreeOfParallelism)
+		{
+			if (maxDegreeOfParallelism <= 1 || (long)bandRowBytes * height < MinimumParallelBytes)
+				return height;
+
+			var minimumRows = Math.Max (1, MinimumBandBytes / Math.Max (1, bandRowBytes));
+			var bands = maxDegreeOfParallelism * BandsPerThread;
+			return Math.Min (height, Math.Max (minimumRows, (height + bands - 1) / bands));
+		}
+	}
+}
@@ -5,19 +5,19 @@ namespace SkiaSharp
 {
 	public unsafe class SKColorSpace : SKObject, ISKNonVirtualReferenceCounted
 	{
-		private static readonly SKColorSpace srgb;
-		private static readonly SKColorSpace srgbLinear;
-
-		static SKColorSpace ()
-		{
-			srgb = new SKColorSpaceStatic (SkiaApi.sk_colorspace_new_srgb ());
-			srgbLinear = new SKColorSpaceStatic (SkiaApi.sk_colorspace_new_srgb_linear ());
-		}
+		private static readonly Lazy<SKColorSpace> srgb =
+			new Lazy<SKColorSpace> (() => SKStartupTrace.Measure ("SKColorSpace.Srgb", () =>
+				new SKColorSpaceStatic (SkiaApi.sk_colorspace_new_srgb ())));
+		private static readonly Lazy<SKColorSpace> srgbLinear =
+			new Lazy<SKColorSpace> (() => SKStartupTrace.Measure ("SKColorSpace.SrgbLinear", () =>
+				new SKColorSpaceStatic (SkiaApi.sk_colorspace_new_srgb_linear ())));
 
 		internal static void EnsureStaticInstanceAreInitialized ()
 		{
 			// IMPORTANT: do not remove to ensure that the static instances
-			//            are initialized before any access is made to them
+			//            are registered before any other wrapper for the same handle
+			_ = srgb.Value;
+			_ = srgbLinear.Value;
 		}
 
 		internal SKColorSpace (IntPtr handle, bool owns)
@@ -80,11 +80,11 @@ namespace SkiaSharp
 
 		// CreateSrgb
 
-		public static SKColorSpace CreateSrgb () => srgb;
+		public static SKColorSpace CreateSrgb () => srgb.Value;
 
 		// CreateSrgbLinear
 
-		public static SKColorSpace CreateSrgbLinear () => srgbLinear;
+		public static SKColorSpace CreateSrgbLinear () => srgbLinear.Value;
 
 		// CreateIcc
 
@@ -259,8 +259,14 @@ namespace SkiaSharp
 
 		//
 
-		internal static SKColorSpace GetObject (IntPtr handle, bool owns = true, bool unrefExisting = true) =>
-			GetOrAddObject (handle, owns, unrefExisting, (h, o) => new SKColorSpace (h, o));
+		internal static SKColorSpace GetObject (IntPtr handle, bool owns = true, bool unrefExisting = true)
+		{
+			if (handle == IntPtr.Zero)
+				return null;
+
+			EnsureStaticInstanceAreInitialized ();
+			return GetOrAddObject (handle, owns, unrefExisting, (h, o) => new SKColorSpace (h, o));
+		}
 
 		private sealed class SKColorSpaceStatic : SKColorSpace
 		{
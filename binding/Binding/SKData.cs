@@ -2,6 +2,8 @@
 using System.IO;
 using System.Runtime.InteropServices;
 using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
 
 namespace SkiaSharp
 {
@@ -12,17 +14,15 @@ namespace SkiaSharp
 		// improvement in Copy performance.
 		internal const int CopyBufferSize = 81920;
 
-		private static readonly SKData empty;
-
-		static SKData ()
-		{
-			empty = new SKDataStatic (SkiaApi.sk_data_new_empty ());
-		}
+		private static readonly Lazy<SKData> empty =
+			new Lazy<SKData> (() => SKStartupTrace.Measure ("SKData.Empty", () =>
+				new SKDataStatic (SkiaApi.sk_data_new_empty ())));
 
 		internal static void EnsureStaticInstanceAreInitialized ()
 		{
 			// IMPORTANT: do not remove to ensure that the static instances
-			//            are initialized before any access is made to them
+			//            are registered before any other wrapper for the same handle
+			_ = empty.Value;
 		}
 
 		internal SKData (IntPtr x, bool owns)
@@ -30,14 +30,20 @@ namespace SkiaSharp
 		{
 		}
 
-		protected override void Dispose (bool disposing) =>
+		// the size of the bytes that were allocated by the data itself
+		private long nativeBytes;
+
+		protected override void Dispose (bool disposing)
+		{
 			base.Dispose (disposing);
+			SKNativeMemory.Release (ref nativeBytes);
+		}
 
 		void ISKNonVirtualReferenceCounted.ReferenceNative () => SkiaApi.sk_data_ref (Handle);
 
 		void ISKNonVirtualReferenceCounted.UnreferenceNative () => SkiaApi.sk_data_unref (Handle);
 
-		public static SKData Empty => empty;
+		public static SKData Empty => empty.Value;
 
 		// CreateCopy
 
@@ -51,7 +57,7 @@ namespace SkiaSharp
 		{
 			if (!PlatformConfiguration.Is64Bit && length > UInt32.MaxValue)
 				throw new ArgumentOutOfRangeException (nameof (length), "The length exceeds the size of pointers.");
-			return GetObject (SkiaApi.sk_data_new_with_copy ((void*)bytes, (IntPtr)length));
+			return GetTrackedObject (SkiaApi.sk_data_new_with_copy ((void*)bytes, (IntPtr)length));
 		}
 
 		public static SKData CreateCopy (byte[] bytes) =>
@@ -60,7 +66,7 @@ namespace SkiaSharp
 		public static SKData CreateCopy (byte[] bytes, ulong length)
 		{
 			fixed (byte* b = bytes) {
-				return GetObject (SkiaApi.sk_data_new_with_copy (b, (IntPtr)length));
+				return GetTrackedObject (SkiaApi.sk_data_new_with_copy (b, (IntPtr)length));
 			}
 		}
 
@@ -74,17 +80,17 @@ namespace SkiaSharp
 		// Create
 
 		public static SKData Create (int size) =>
-			GetObject (SkiaApi.sk_data_new_uninitialized ((IntPtr)size));
+			GetTrackedObject (SkiaApi.sk_data_new_uninitialized ((IntPtr)size));
 
 		public static SKData Create (long size) =>
-			GetObject (SkiaApi.sk_data_new_uninitialized ((IntPtr)size));
+			GetTrackedObject (SkiaApi.sk_data_new_uninitialized ((IntPtr)size));
 
 		public static SKData Create (ulong size)
 		{
 			if (!PlatformConfiguration.Is64Bit && size > UInt32.MaxValue)
 				throw new ArgumentOutOfRangeException (nameof (size), "The size exceeds the size of pointers.");
 
-			return GetObject (SkiaApi.sk_data_new_uninitialized ((IntPtr)size));
+			return GetTrackedObject (SkiaApi.sk_data_new_uninitialized ((IntPtr)size));
 		}
 
 		public static SKData Create (string filename)
@@ -113,6 +119,19 @@ namespace SkiaSharp
 			}
 		}
 
+		// CreateAsync
+
+		public static Task<SKData> CreateAsync (Stream stream) =>
+			CreateAsync (stream, CancellationToken.None);
+
+		public static Task<SKData> CreateAsync (Stream stream, CancellationToken cancellationToken)
+		{
+			if (stream == null)
+				throw new ArgumentNullException (nameof (stream));
+
+			return SKAsyncDecoding.ReadDataAsync (stream, cancellationToken);
+		}
+
 		public static SKData Create (Stream stream, int length)
 		{
 			if (stream == null)
@@ -153,7 +172,7 @@ namespace SkiaSharp
 			if (stream == null)
 				throw new ArgumentNullException (nameof (stream));
 
-			return GetObject (SkiaApi.sk_data_new_from_stream (stream.Handle, (IntPtr)length));
+			return GetTrackedObject (SkiaApi.sk_data_new_from_stream (stream.Handle, (IntPtr)length));
 		}
 
 		public static SKData Create (SKStream stream, ulong length)
@@ -161,7 +180,7 @@ namespace SkiaSharp
 			if (stream == null)
 				throw new ArgumentNullException (nameof (stream));
 
-			return GetObject (SkiaApi.sk_data_new_from_stream (stream.Handle, (IntPtr)length));
+			return GetTrackedObject (SkiaApi.sk_data_new_from_stream (stream.Handle, (IntPtr)length));
 		}
 
 		public static SKData Create (SKStream stream, long length)
@@ -169,7 +188,7 @@ namespace SkiaSharp
 			if (stream == null)
 				throw new ArgumentNullException (nameof (stream));
 
-			return GetObject (SkiaApi.sk_data_new_from_stream (stream.Handle, (IntPtr)length));
+			return GetTrackedObject (SkiaApi.sk_data_new_from_stream (stream.Handle, (IntPtr)length));
 		}
 
 		public static SKData Create (IntPtr address, int length)
@@ -264,8 +283,23 @@ namespace SkiaSharp
 			GC.KeepAlive (this);
 		}
 
-		internal static SKData GetObject (IntPtr handle) =>
-			GetOrAddObject (handle, (h, o) => new SKData (h, o));
+		internal static SKData GetObject (IntPtr handle)
+		{
+			if (handle == IntPtr.Zero)
+				return null;
+
+			EnsureStaticInstanceAreInitialized ();
+			return GetOrAddObject (handle, (h, o) => new SKData (h, o));
+		}
+
+		// the bytes are only held by this data, so it accounts for them
+		internal static SKData GetTrackedObject (IntPtr handle)
+		{
+			var data = GetObject (handle);
+			if (data != null && data.OwnsHandle)
+				SKNativeMemory.Track (ref data.nativeBytes, data.Size);
+			return data;
+		}
 
 		//
 
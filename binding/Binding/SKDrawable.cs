@@ -10,6 +10,9 @@ namespace SkiaSharp
 
 		private int fromNative;
 
+		// the cached rendering, which is owned by SKDrawableCache
+		internal SKDrawableCache.Entry rasterCacheEntry;
+
 		static SKDrawable ()
 		{
 			delegates = new SKManagedDrawableDelegates {
@@ -46,6 +49,14 @@ namespace SkiaSharp
 		protected override void Dispose (bool disposing) =>
 			base.Dispose (disposing);
 
+		protected override void DisposeManaged ()
+		{
+			if (rasterCacheEntry != null)
+				SKDrawableCache.Remove (this);
+
+			base.DisposeManaged ();
+		}
+
 		protected override void DisposeNative ()
 		{
 			if (Interlocked.CompareExchange (ref fromNative, 0, 0) == 0)
@@ -62,7 +73,23 @@ namespace SkiaSharp
 			}
 		}
 
+		// when enabled, the drawable is rasterized the first time it is drawn
+		// and the image is drawn until the drawing changes or the transform
+		// moves to a different scale or rotation bucket
+		public bool IsRasterCacheEnabled { get; set; }
+
 		public void Draw (SKCanvas canvas, ref SKMatrix matrix)
+		{
+			if (canvas == null)
+				throw new ArgumentNullException (nameof (canvas));
+
+			if (IsRasterCacheEnabled && SKDrawableCache.TryDraw (this, canvas, matrix))
+				return;
+
+			DrawUncached (canvas, ref matrix);
+		}
+
+		internal void DrawUncached (SKCanvas canvas, ref SKMatrix matrix)
 		{
 			fixed (SKMatrix* m = &matrix) {
 				SkiaApi.sk_drawable_draw (Handle, canvas.Handle, m);
@@ -79,9 +106,15 @@ namespace SkiaSharp
 		public SKPicture Snapshot () =>
 			SKPicture.GetObject (SkiaApi.sk_drawable_new_picture_snapshot (Handle), unrefExisting: false);
 
-		public void NotifyDrawingChanged () =>
+		public void NotifyDrawingChanged ()
+		{
 			SkiaApi.sk_drawable_notify_drawing_changed (Handle);
 
+			// the cached image can never be used again
+			if (rasterCacheEntry != null)
+				SKDrawableCache.Remove (this);
+		}
+
 		protected virtual void OnDraw (SKCanvas canvas)
 		{
 		}
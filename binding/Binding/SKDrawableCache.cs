@@ -0,0 +1,367 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace SkiaSharp
+{
+	// The rasterized output of the drawables that have the raster cache
+	// enabled. A drawable is rendered into an image at the scale and rotation
+	// of the canvas, and the image is drawn instead for as long as the
+	// generation ID of the drawable is the same and the canvas transform stays
+	// in the same scale and rotation buckets. Translations never invalidate
+	// the image. All the images share a single byte budget.
+	public static class SKDrawableCache
+	{
+		public const long DefaultMaxBytes = 32 * 1024 * 1024;
+
+		// a quarter of an octave between each scale bucket
+		private const float ScaleBucketsPerOctave = 4f;
+		private const float RotationBucketDegrees = 5f;
+
+		// the transform is only treated as a scale and rotation if the
+		// axes are this close to perpendicular
+		private const float SkewTolerance = 1e-3f;
+
+		private static readonly object locker = new object ();
+		private static readonly LinkedList<Entry> recentlyUsed = new LinkedList<Entry> ();
+
+		private static long maxBytes = DefaultMaxBytes;
+		private static long currentBytes;
+		private static long hitCount;
+		private static long missCount;
+		private static long evictionCount;
+
+		public static long MaxBytes {
+			get {
+				lock (locker) {
+					return maxBytes;
+				}
+			}
+			set {
+				if (value <= 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The maximum number of bytes must be greater than zero.");
+
+				lock (locker) {
+					maxBytes = value;
+					Trim (0);
+				}
+			}
+		}
+
+		// the pixel bytes of all the cached images
+		public static long CurrentBytes {
+			get {
+				lock (locker) {
+					return currentBytes;
+				}
+			}
+		}
+
+		public static int Count {
+			get {
+				lock (locker) {
+					return recentlyUsed.Count;
+				}
+			}
+		}
+
+		public static long HitCount => Interlocked.Read (ref hitCount);
+
+		public static long MissCount => Interlocked.Read (ref missCount);
+
+		public static long EvictionCount => Interlocked.Read (ref evictionCount);
+
+		public static void ResetStatistics ()
+		{
+			Interlocked.Exchange (ref hitCount, 0);
+			Interlocked.Exchange (ref missCount, 0);
+			Interlocked.Exchange (ref evictionCount, 0);
+		}
+
+		public static void Clear ()
+		{
+			lock (locker) {
+				while (recentlyUsed.Last != null)
+					Evict (recentlyUsed.Last.Value, count: false);
+			}
+		}
+
+		// returns false if the drawable could not be drawn from the cache, and
+		// the caller must draw it normally
+		internal static bool TryDraw (SKDrawable drawable, SKCanvas canvas, SKMatrix matrix)
+		{
+			// a picture or a document would keep an image instead of the
+			// drawing, and it may be played back at any scale
+			if (!canvas.DrawsToPixels)
+				return false;
+
+			var total = canvas.TotalMatrix.PreConcat (matrix);
+			if (!TryGetBuckets (total, out var key))
+				return false;
+
+			key.GenerationId = drawable.GenerationId;
+
+			var entry = Acquire (drawable, key);
+			if (entry == null) {
+				Interlocked.Increment (ref missCount);
+
+				entry = Render (drawable, total, key);
+				if (entry == null)
+					return false;
+			} else {
+				Interlocked.Increment (ref hitCount);
+			}
+
+			try {
+				// image pixels -> raster space -> drawable space -> canvas
+				var imageToLocal = entry.InverseRaster.PreConcat (SKMatrix.CreateTranslation (entry.Origin.X, entry.Origin.Y));
+				var imageToDevice = total.PreConcat (imageToLocal);
+
+				canvas.Save ();
+				try {
+					canvas.Concat (ref matrix);
+					canvas.Concat (ref imageToLocal);
+
+					if (IsIntegerTranslation (imageToDevice)) {
+						canvas.DrawImage (entry.Image, 0, 0);
+					} else {
+						// the transform is not exactly the one that was rendered
+						using var paint = new SKPaint { FilterQuality = SKFilterQuality.Low };
+						canvas.DrawImage (entry.Image, 0, 0, paint);
+					}
+				} finally {
+					canvas.Restore ();
+				}
+			} finally {
+				Release (entry);
+			}
+
+			return true;
+		}
+
+		internal static void Remove (SKDrawable drawable)
+		{
+			lock (locker) {
+				var entry = drawable.rasterCacheEntry;
+				if (entry != null && !entry.IsEvicted)
+					Evict (entry, count: false);
+				drawable.rasterCacheEntry = null;
+			}
+		}
+
+		internal static bool TryGetBuckets (SKMatrix matrix, out EntryKey key)
+		{
+			key = default;
+
+			if (matrix.Persp0 != 0 || matrix.Persp1 != 0 || matrix.Persp2 != 1)
+				return false;
+
+			var scaleX = Math.Sqrt (matrix.ScaleX * matrix.ScaleX + matrix.SkewY * matrix.SkewY);
+			var scaleY = Math.Sqrt (matrix.SkewX * matrix.SkewX + matrix.ScaleY * matrix.ScaleY);
+			if (scaleX <= 0 || scaleY <= 0 || double.IsNaN (scaleX) || double.IsNaN (scaleY) || double.IsInfinity (scaleX) || double.IsInfinity (scaleY))
+				return false;
+
+			// the two axes must be perpendicular and not mirrored
+			var dot = (matrix.ScaleX * matrix.SkewX + matrix.SkewY * matrix.ScaleY) / (scaleX * scaleY);
+			var cross = matrix.ScaleX * matrix.ScaleY - matrix.SkewX * matrix.SkewY;
+			if (Math.Abs (dot) > SkewTolerance || cross <= 0)
+				return false;
+
+			var degrees = Math.Atan2 (matrix.SkewY, matrix.ScaleX) * 180.0 / Math.PI;
+
+			key.ScaleX = (int)Math.Round (Math.Log (scaleX, 2) * ScaleBucketsPerOctave);
+			key.ScaleY = (int)Math.Round (Math.Log (scaleY, 2) * ScaleBucketsPerOctave);
+			key.Rotation = (int)Math.Round (degrees / RotationBucketDegrees);
+			if (key.Rotation * RotationBucketDegrees >= 180)
+				key.Rotation = (int)Math.Round (-180 / RotationBucketDegrees);
+
+			key.RasterScaleX = (float)scaleX;
+			key.RasterScaleY = (float)scaleY;
+			key.RasterDegrees = (float)degrees;
+			return true;
+		}
+
+		private static Entry Render (SKDrawable drawable, SKMatrix total, EntryKey key)
+		{
+			var bounds = drawable.Bounds;
+			if (bounds.IsEmpty)
+				return null;
+
+			// render with the exact transform, so the common case of a static
+			// transform draws the pixels as they are
+			var raster = SKMatrix.CreateRotationDegrees (key.RasterDegrees)
+				.PreConcat (SKMatrix.CreateScale (key.RasterScaleX, key.RasterScaleY));
+			if (!raster.TryInvert (out var inverseRaster))
+				return null;
+
+			var deviceBounds = raster.MapRect (bounds);
+			var fraction = new SKPoint (total.TransX - (float)Math.Floor (total.TransX), total.TransY - (float)Math.Floor (total.TransY));
+			deviceBounds.Offset (fraction);
+			var pixelBounds = SKRectI.Ceiling (deviceBounds, true);
+			if (pixelBounds.Width <= 0 || pixelBounds.Height <= 0)
+				return null;
+
+			var info = new SKImageInfo (pixelBounds.Width, pixelBounds.Height);
+
+			// do not let a single drawable take over the whole cache
+			var byteCount = info.BytesSize64;
+			if (byteCount > MaxBytes / 4)
+				return null;
+
+			using var surface = SKSurface.Create (info);
+			if (surface == null)
+				return null;
+
+			var toRaster = raster.PostConcat (SKMatrix.CreateTranslation (fraction.X - pixelBounds.Left, fraction.Y - pixelBounds.Top));
+			surface.Canvas.Clear (SKColors.Transparent);
+			drawable.DrawUncached (surface.Canvas, ref toRaster);
+
+			var image = surface.Snapshot ();
+			if (image == null)
+				return null;
+
+			var origin = new SKPoint (pixelBounds.Left - fraction.X, pixelBounds.Top - fraction.Y);
+			return Add (drawable, key, image, inverseRaster, origin, byteCount);
+		}
+
+		private static Entry Acquire (SKDrawable drawable, EntryKey key)
+		{
+			lock (locker) {
+				var entry = drawable.rasterCacheEntry;
+				if (entry == null || entry.IsEvicted || !entry.Key.Matches (key))
+					return null;
+
+				recentlyUsed.Remove (entry.Node);
+				recentlyUsed.AddFirst (entry.Node);
+
+				entry.Leases++;
+				return entry;
+			}
+		}
+
+		private static Entry Add (SKDrawable drawable, EntryKey key, SKImage image, SKMatrix inverseRaster, SKPoint origin, long byteCount)
+		{
+			var entry = new Entry (key, image, inverseRaster, origin, byteCount);
+
+			lock (locker) {
+				// a new rendering replaces the old one
+				var existing = drawable.rasterCacheEntry;
+				if (existing != null && !existing.IsEvicted)
+					Evict (existing, count: false);
+
+				drawable.rasterCacheEntry = entry;
+				entry.Node = recentlyUsed.AddFirst (entry);
+				currentBytes += byteCount;
+				entry.Leases++;
+
+				Trim (0);
+			}
+
+			return entry;
+		}
+
+		private static void Release (Entry entry)
+		{
+			SKImage dispose = null;
+
+			lock (locker) {
+				entry.Leases--;
+				if (entry.IsEvicted && entry.Leases == 0)
+					dispose = entry.TakeImage ();
+				else
+					Trim (0);
+			}
+
+			dispose?.Dispose ();
+		}
+
+		private static void Trim (long needed)
+		{
+			// the least recently drawn images that are not being drawn right
+			// now are evicted first
+			var node = recentlyUsed.Last;
+			while (currentBytes + needed > maxBytes && node != null) {
+				var previous = node.Previous;
+				if (node.Value.Leases == 0)
+					Evict (node.Value);
+				node = previous;
+			}
+		}
+
+		private static void Evict (Entry entry, bool count = true)
+		{
+			recentlyUsed.Remove (entry.Node);
+
+			entry.IsEvicted = true;
+			currentBytes -= entry.ByteCount;
+
+			if (count)
+				evictionCount++;
+
+			// images that are being drawn are disposed when they are released
+			if (entry.Leases == 0)
+				entry.TakeImage ()?.Dispose ();
+		}
+
+		private static bool IsIntegerTranslation (SKMatrix matrix) =>
+			Math.Abs (matrix.ScaleX - 1) < 1e-4f && Math.Abs (matrix.ScaleY - 1) < 1e-4f &&
+			Math.Abs (matrix.SkewX) < 1e-4f && Math.Abs (matrix.SkewY) < 1e-4f &&
+			Math.Abs (matrix.TransX - Math.Round (matrix.TransX)) < 1e-3f &&
+			Math.Abs (matrix.TransY - Math.Round (matrix.TransY)) < 1e-3f;
+
+		internal struct EntryKey
+		{
+			public uint GenerationId;
+
+			public int ScaleX;
+			public int ScaleY;
+			public int Rotation;
+
+			// the exact values that the image is rendered with
+			public float RasterScaleX;
+			public float RasterScaleY;
+			public float RasterDegrees;
+
+			public readonly bool Matches (EntryKey other) =>
+				GenerationId == other.GenerationId &&
+				ScaleX == other.ScaleX &&
+				ScaleY == other.ScaleY &&
+				Rotation == other.Rotation;
+		}
+
+		internal sealed class Entry
+		{
+			private SKImage image;
+
+			public Entry (EntryKey key, SKImage image, SKMatrix inverseRaster, SKPoint origin, long byteCount)
+			{
+				Key = key;
+				InverseRaster = inverseRaster;
+				Origin = origin;
+				ByteCount = byteCount;
+				this.image = image;
+			}
+
+			public EntryKey Key { get; }
+
+			public SKImage Image => image;
+
+			// maps the raster space back to the drawable space
+			public SKMatrix InverseRaster { get; }
+
+			// the position of the image in the raster space
+			public SKPoint Origin { get; }
+
+			public long ByteCount { get; }
+
+			public int Leases { get; set; }
+
+			public bool IsEvicted { get; set; }
+
+			public LinkedListNode<Entry> Node { get; set; }
+
+			public SKImage TakeImage () =>
+				Interlocked.Exchange (ref image, null);
+		}
+	}
+}
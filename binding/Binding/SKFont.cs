@@ -10,6 +10,13 @@ namespace SkiaSharp
 		internal const float DefaultScaleX = 1f;
 		internal const float DefaultSkewX = 0f;
 
+		// the glyph advances for the width-only batch measurements, indexed
+		// by the glyph id and NaN for glyphs that have not been measured yet
+		private float[] advanceCache;
+
+		// bumped every time that the font changes
+		private int version;
+
 		internal SKFont (IntPtr handle, bool owns)
 			: base (handle, owns)
 		{
@@ -34,62 +41,98 @@ namespace SkiaSharp
 
 		public bool ForceAutoHinting {
 			get => SkiaApi.sk_font_is_force_auto_hinting (Handle);
-			set => SkiaApi.sk_font_set_force_auto_hinting (Handle, value);
+			set {
+				SkiaApi.sk_font_set_force_auto_hinting (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public bool EmbeddedBitmaps {
 			get => SkiaApi.sk_font_is_embedded_bitmaps (Handle);
-			set => SkiaApi.sk_font_set_embedded_bitmaps (Handle, value);
+			set {
+				SkiaApi.sk_font_set_embedded_bitmaps (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public bool Subpixel {
 			get => SkiaApi.sk_font_is_subpixel (Handle);
-			set => SkiaApi.sk_font_set_subpixel (Handle, value);
+			set {
+				SkiaApi.sk_font_set_subpixel (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public bool LinearMetrics {
 			get => SkiaApi.sk_font_is_linear_metrics (Handle);
-			set => SkiaApi.sk_font_set_linear_metrics (Handle, value);
+			set {
+				SkiaApi.sk_font_set_linear_metrics (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public bool Embolden {
 			get => SkiaApi.sk_font_is_embolden (Handle);
-			set => SkiaApi.sk_font_set_embolden (Handle, value);
+			set {
+				SkiaApi.sk_font_set_embolden (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public bool BaselineSnap {
 			get => SkiaApi.sk_font_is_baseline_snap (Handle);
-			set => SkiaApi.sk_font_set_baseline_snap (Handle, value);
+			set {
+				SkiaApi.sk_font_set_baseline_snap (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public SKFontEdging Edging {
 			get => SkiaApi.sk_font_get_edging (Handle);
-			set => SkiaApi.sk_font_set_edging (Handle, value);
+			set {
+				SkiaApi.sk_font_set_edging (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public SKFontHinting Hinting {
 			get => SkiaApi.sk_font_get_hinting (Handle);
-			set => SkiaApi.sk_font_set_hinting (Handle, value);
+			set {
+				SkiaApi.sk_font_set_hinting (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public SKTypeface Typeface {
 			get => SKTypeface.GetObject (SkiaApi.sk_font_get_typeface (Handle));
-			set => SkiaApi.sk_font_set_typeface (Handle, value == null ? IntPtr.Zero : value.Handle);
+			set {
+				SkiaApi.sk_font_set_typeface (Handle, value == null ? IntPtr.Zero : value.Handle);
+				Invalidate ();
+			}
 		}
 
 		public float Size {
 			get => SkiaApi.sk_font_get_size (Handle);
-			set => SkiaApi.sk_font_set_size (Handle, value);
+			set {
+				SkiaApi.sk_font_set_size (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public float ScaleX {
 			get => SkiaApi.sk_font_get_scale_x (Handle);
-			set => SkiaApi.sk_font_set_scale_x (Handle, value);
+			set {
+				SkiaApi.sk_font_set_scale_x (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		public float SkewX {
 			get => SkiaApi.sk_font_get_skew_x (Handle);
-			set => SkiaApi.sk_font_set_skew_x (Handle, value);
+			set {
+				SkiaApi.sk_font_set_skew_x (Handle, value);
+				Invalidate ();
+			}
 		}
 
 		// FontSpacing
@@ -337,6 +380,237 @@ namespace SkiaSharp
 			}
 		}
 
+		// MeasureText (batch)
+
+		public void MeasureText (IReadOnlyList<string> texts, Span<float> widths, SKPaint paint = null) =>
+			MeasureText (texts, widths, Span<SKRect>.Empty, paint);
+
+		public void MeasureText (IReadOnlyList<string> texts, Span<float> widths, Span<SKRect> bounds, SKPaint paint = null)
+		{
+			if (texts == null)
+				throw new ArgumentNullException (nameof (texts));
+
+			var count = texts.Count;
+			var totalLength = 0;
+			for (var i = 0; i < count; i++)
+				totalLength += texts[i]?.Length ?? 0;
+
+			// join all the strings into a single buffer so they can be measured as ranges
+			using var buffer = Utils.RentArray<char> (totalLength);
+			using var lengths = Utils.RentArray<int> (count);
+			var offset = 0;
+			for (var i = 0; i < count; i++) {
+				var text = texts[i];
+				var length = text?.Length ?? 0;
+				if (length > 0)
+					text.AsSpan ().CopyTo (buffer.Span.Slice (offset));
+				lengths[i] = length;
+				offset += length;
+			}
+
+			MeasureText (buffer, lengths, widths, bounds, paint);
+		}
+
+		public void MeasureText (ReadOnlySpan<char> text, ReadOnlySpan<int> lengths, Span<float> widths, SKPaint paint = null) =>
+			MeasureText (text, lengths, widths, Span<SKRect>.Empty, paint);
+
+		public void MeasureText (ReadOnlySpan<char> text, ReadOnlySpan<int> lengths, Span<float> widths, Span<SKRect> bounds, SKPaint paint = null)
+		{
+			var count = lengths.Length;
+			if (widths.Length != 0 && widths.Length != count)
+				throw new ArgumentException ("The length of widths must be the same as the number of ranges or empty.", nameof (widths));
+			if (bounds.Length != 0 && bounds.Length != count)
+				throw new ArgumentException ("The length of bounds must be the same as the number of ranges or empty.", nameof (bounds));
+
+			// each valid UTF-16 code point maps to exactly one glyph, so the glyph
+			// runs for each range can be found without asking skia for each range
+			using var glyphCounts = Utils.RentArray<int> (count);
+			var textLength = 0;
+			var glyphCount = 0;
+			var isValid = true;
+			for (var i = 0; i < count; i++) {
+				var length = lengths[i];
+				if (length < 0)
+					throw new ArgumentOutOfRangeException (nameof (lengths), "The range lengths must not be negative.");
+				if (length > text.Length - textLength)
+					throw new ArgumentOutOfRangeException (nameof (lengths), "The range lengths must not exceed the length of the text.");
+
+				var n = CountCodePoints (text.Slice (textLength, length));
+				if (n < 0)
+					isValid = false;
+
+				glyphCounts[i] = n;
+				glyphCount += n;
+				textLength += length;
+			}
+
+			if (count == 0)
+				return;
+
+			if (!isValid) {
+				// unpaired surrogates are handled differently by skia, so let it do the work
+				MeasureTextRanges (text, lengths, widths, bounds, paint);
+				return;
+			}
+
+			using var glyphs = Utils.RentArray<ushort> (glyphCount);
+			if (glyphCount > 0) {
+				int converted;
+				fixed (char* t = text)
+				fixed (ushort* g = glyphs) {
+					converted = SkiaApi.sk_font_text_to_glyphs (Handle, t, (IntPtr)(textLength * 2), SKTextEncoding.Utf16, g, glyphCount);
+				}
+
+				if (converted != glyphCount) {
+					MeasureTextRanges (text, lengths, widths, bounds, paint);
+					return;
+				}
+			}
+
+			MeasureGlyphRuns (glyphs, glyphCounts, widths, bounds, paint);
+		}
+
+		private void MeasureTextRanges (ReadOnlySpan<char> text, ReadOnlySpan<int> lengths, Span<float> widths, Span<SKRect> bounds, SKPaint paint)
+		{
+			var offset = 0;
+			for (var i = 0; i < lengths.Length; i++) {
+				var range = text.Slice (offset, lengths[i]);
+				offset += range.Length;
+
+				SKRect rect = default;
+				var width = range.Length == 0
+					? 0
+					: bounds.Length > 0
+						? MeasureText (range, out rect, paint)
+						: MeasureText (range, paint);
+
+				if (widths.Length > 0)
+					widths[i] = width;
+				if (bounds.Length > 0)
+					bounds[i] = rect;
+			}
+		}
+
+		private void MeasureGlyphRuns (ReadOnlySpan<ushort> glyphs, ReadOnlySpan<int> glyphCounts, Span<float> widths, Span<SKRect> bounds, SKPaint paint)
+		{
+			using var advances = Utils.RentArray<float> (glyphs.Length);
+			using var glyphBounds = Utils.RentArray<SKRect> (bounds.Length > 0 ? glyphs.Length : 0);
+
+			if (glyphs.Length > 0) {
+				// the paint may change the advances, so only plain widths are cached
+				if (bounds.Length == 0 && paint == null)
+					GetCachedGlyphAdvances (glyphs, advances);
+				else
+					GetGlyphWidths (glyphs, advances, glyphBounds, paint);
+			}
+
+			var start = 0;
+			for (var i = 0; i < glyphCounts.Length; i++) {
+				var end = start + glyphCounts[i];
+
+				// this is the same as SkFont::measureText
+				var width = 0f;
+				var rect = SKRect.Empty;
+				for (var g = start; g < end; g++) {
+					if (bounds.Length > 0) {
+						var r = glyphBounds[g];
+						if (r.Left < r.Right && r.Top < r.Bottom) {
+							r.Offset (width, 0);
+							if (rect.Left < rect.Right && rect.Top < rect.Bottom)
+								rect = SKRect.Union (rect, r);
+							else
+								rect = r;
+						}
+					}
+					width += advances[g];
+				}
+
+				if (widths.Length > 0)
+					widths[i] = width;
+				if (bounds.Length > 0)
+					bounds[i] = rect;
+
+				start = end;
+			}
+		}
+
+		private void GetCachedGlyphAdvances (ReadOnlySpan<ushort> glyphs, Span<float> advances)
+		{
+			var maxGlyph = 0;
+			for (var i = 0; i < glyphs.Length; i++) {
+				if (glyphs[i] > maxGlyph)
+					maxGlyph = glyphs[i];
+			}
+
+			var cache = advanceCache;
+			if (cache == null || cache.Length <= maxGlyph) {
+				var size = Math.Max (cache?.Length ?? 0, 256);
+				while (size <= maxGlyph)
+					size *= 2;
+
+				var newCache = new float[size];
+				var copied = 0;
+				if (cache != null) {
+					Array.Copy (cache, newCache, cache.Length);
+					copied = cache.Length;
+				}
+				for (var i = copied; i < newCache.Length; i++)
+					newCache[i] = float.NaN;
+
+				cache = newCache;
+				advanceCache = cache;
+			}
+
+			// measure all the new glyphs with a single call
+			using var missing = Utils.RentArray<ushort> (glyphs.Length);
+			var missingCount = 0;
+			for (var i = 0; i < glyphs.Length; i++) {
+				var glyph = glyphs[i];
+				if (float.IsNaN (cache[glyph])) {
+					// mark it so that duplicates are only measured once
+					cache[glyph] = float.PositiveInfinity;
+					missing[missingCount++] = glyph;
+				}
+			}
+
+			if (missingCount > 0) {
+				using var missingAdvances = Utils.RentArray<float> (missingCount);
+				GetGlyphWidths (missing.Span.Slice (0, missingCount), missingAdvances, Span<SKRect>.Empty);
+				for (var i = 0; i < missingCount; i++)
+					cache[missing[i]] = missingAdvances[i];
+			}
+
+			for (var i = 0; i < glyphs.Length; i++)
+				advances[i] = cache[glyphs[i]];
+		}
+
+		// the caches that are keyed on the font instance compare the version
+		// instead of reading all the settings back from the native font
+		internal int Version => version;
+
+		internal void Invalidate ()
+		{
+			advanceCache = null;
+			version++;
+		}
+
+		private static int CountCodePoints (ReadOnlySpan<char> text)
+		{
+			var count = 0;
+			for (var i = 0; i < text.Length; i++) {
+				var c = text[i];
+				if (char.IsHighSurrogate (c)) {
+					if (i + 1 >= text.Length || !char.IsLowSurrogate (text[i + 1]))
+						return -1;
+					i++;
+				} else if (char.IsLowSurrogate (c)) {
+					return -1;
+				}
+				count++;
+			}
+			return count;
+		}
+
 		// BreakText
 
 		internal int BreakText (string text, float maxWidth, out float measuredWidth, SKPaint paint = null) =>
@@ -7,17 +7,15 @@ namespace SkiaSharp
 {
 	public unsafe class SKFontManager : SKObject, ISKReferenceCounted
 	{
-		private static readonly SKFontManager defaultManager;
-
-		static SKFontManager ()
-		{
-			defaultManager = new SKFontManagerStatic (SkiaApi.sk_fontmgr_ref_default ());
-		}
+		private static readonly Lazy<SKFontManager> defaultManager =
+			new Lazy<SKFontManager> (() => SKStartupTrace.Measure ("SKFontManager.Default", () =>
+				new SKFontManagerStatic (SkiaApi.sk_fontmgr_ref_default ())));
 
 		internal static void EnsureStaticInstanceAreInitialized ()
 		{
 			// IMPORTANT: do not remove to ensure that the static instances
-			//            are initialized before any access is made to them
+			//            are registered before any other wrapper for the same handle
+			_ = defaultManager.Value;
 		}
 
 		internal SKFontManager (IntPtr handle, bool owns)
@@ -28,7 +26,7 @@ namespace SkiaSharp
 		protected override void Dispose (bool disposing) =>
 			base.Dispose (disposing);
 
-		public static SKFontManager Default => defaultManager;
+		public static SKFontManager Default => defaultManager.Value;
 
 		public int FontFamilyCount => SkiaApi.sk_fontmgr_count_families (Handle);
 
@@ -194,8 +192,14 @@ namespace SkiaSharp
 
 		//
 
-		internal static SKFontManager GetObject (IntPtr handle) =>
-			GetOrAddObject (handle, (h, o) => new SKFontManager (h, o));
+		internal static SKFontManager GetObject (IntPtr handle)
+		{
+			if (handle == IntPtr.Zero)
+				return null;
+
+			EnsureStaticInstanceAreInitialized ();
+			return GetOrAddObject (handle, (h, o) => new SKFontManager (h, o));
+		}
 
 		//
 
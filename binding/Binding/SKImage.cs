@@ -1,6 +1,8 @@
 ﻿using System;
 using System.ComponentModel;
 using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
 using System.Runtime.InteropServices;
 
 namespace SkiaSharp
@@ -13,13 +15,22 @@ namespace SkiaSharp
 
 	public unsafe class SKImage : SKObject, ISKReferenceCounted
 	{
+		// the size of the pixels that were copied into the image
+		private long nativeBytes;
+
 		internal SKImage (IntPtr x, bool owns)
 			: base (x, owns)
 		{
 		}
 
-		protected override void Dispose (bool disposing) =>
+		protected override void Dispose (bool disposing)
+		{
 			base.Dispose (disposing);
+			SKNativeMemory.Release (ref nativeBytes);
+		}
+
+		private void TrackPixels (long bytes) =>
+			SKNativeMemory.Track (ref nativeBytes, bytes);
 
 		// create brand new image
 
@@ -28,7 +39,9 @@ namespace SkiaSharp
 			var pixels = Marshal.AllocCoTaskMem (info.BytesSize);
 			using (var pixmap = new SKPixmap (info, pixels)) {
 				// don't use the managed version as that is just extra overhead which isn't necessary
-				return GetObject (SkiaApi.sk_image_new_raster (pixmap.Handle, DelegateProxies.SKImageRasterReleaseDelegateProxyForCoTaskMem, null));
+				var image = GetObject (SkiaApi.sk_image_new_raster (pixmap.Handle, DelegateProxies.SKImageRasterReleaseDelegateProxyForCoTaskMem, null));
+				image?.TrackPixels (info.BytesSize64);
+				return image;
 			}
 		}
 
@@ -42,7 +55,7 @@ namespace SkiaSharp
 			if (pixels == null)
 				throw new ArgumentNullException (nameof (pixels));
 			using (var data = SKData.Create (pixels)) {
-				return FromPixels (info, data, rowBytes);
+				return FromOwnedPixels (info, data, rowBytes);
 			}
 		}
 
@@ -54,7 +67,7 @@ namespace SkiaSharp
 			if (pixels == null)
 				throw new ArgumentNullException (nameof (pixels));
 			using (var data = SKData.Create (pixels)) {
-				return FromPixels (info, data, rowBytes);
+				return FromOwnedPixels (info, data, rowBytes);
 			}
 		}
 
@@ -66,7 +79,7 @@ namespace SkiaSharp
 			if (pixels == null)
 				throw new ArgumentNullException (nameof (pixels));
 			using (var data = SKData.CreateCopy (pixels)) {
-				return FromPixels (info, data, rowBytes);
+				return FromOwnedPixels (info, data, rowBytes);
 			}
 		}
 
@@ -79,7 +92,9 @@ namespace SkiaSharp
 				throw new ArgumentNullException (nameof (pixels));
 
 			var nInfo = SKImageInfoNative.FromManaged (ref info);
-			return GetObject (SkiaApi.sk_image_new_raster_copy (&nInfo, (void*)pixels, (IntPtr)rowBytes));
+			var image = GetObject (SkiaApi.sk_image_new_raster_copy (&nInfo, (void*)pixels, (IntPtr)rowBytes));
+			image?.TrackPixels (image.Info.BytesSize64);
+			return image;
 		}
 
 		[EditorBrowsable (EditorBrowsableState.Never)]
@@ -91,7 +106,9 @@ namespace SkiaSharp
 		{
 			if (pixmap == null)
 				throw new ArgumentNullException (nameof (pixmap));
-			return GetObject (SkiaApi.sk_image_new_raster_copy_with_pixmap (pixmap.Handle));
+			var image = GetObject (SkiaApi.sk_image_new_raster_copy_with_pixmap (pixmap.Handle));
+			image?.TrackPixels (image.Info.BytesSize64);
+			return image;
 		}
 
 		public static SKImage FromPixelCopy (SKImageInfo info, ReadOnlySpan<byte> pixels) =>
@@ -102,10 +119,18 @@ namespace SkiaSharp
 			if (pixels == null)
 				throw new ArgumentNullException (nameof (pixels));
 			using (var data = SKData.CreateCopy (pixels)) {
-				return FromPixels (info, data, rowBytes);
+				return FromOwnedPixels (info, data, rowBytes);
 			}
 		}
 
+		// the copy is only held by the image, so the image accounts for it
+		private static SKImage FromOwnedPixels (SKImageInfo info, SKData copy, int rowBytes)
+		{
+			var image = FromPixels (info, copy, rowBytes);
+			image?.TrackPixels (copy.Size);
+			return image;
+		}
+
 		// create a new image around existing pixel data
 
 		[EditorBrowsable (EditorBrowsableState.Never)]
@@ -232,6 +257,17 @@ namespace SkiaSharp
 			}
 		}
 
+		public static Task<SKImage> FromEncodedDataAsync (Stream data) =>
+			FromEncodedDataAsync (data, CancellationToken.None);
+
+		public static Task<SKImage> FromEncodedDataAsync (Stream data, CancellationToken cancellationToken)
+		{
+			if (data == null)
+				throw new ArgumentNullException (nameof (data));
+
+			return SKAsyncDecoding.FromEncodedDataAsync (data, cancellationToken);
+		}
+
 		public static SKImage FromEncodedData (string filename)
 		{
 			if (filename == null)
@@ -0,0 +1,426 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace SkiaSharp
+{
+	// A thread-safe cache of decoded images that is bounded by the number of
+	// pixel bytes. Images are cached per source and per size bucket, and the
+	// smaller buckets are decoded at a reduced scale so that a large photo
+	// that is only ever drawn as a thumbnail is never fully decoded.
+	public class SKImageCache : IDisposable
+	{
+		public const long DefaultMaxBytes = 64 * 1024 * 1024;
+
+		private const int MinimumBucket = 32;
+
+		private readonly object locker = new object ();
+		private readonly Dictionary<ImageKey, LinkedListNode<ImageEntry>> entries = new Dictionary<ImageKey, LinkedListNode<ImageEntry>> ();
+		private readonly LinkedList<ImageEntry> recentlyUsed = new LinkedList<ImageEntry> ();
+
+		private long maxBytes;
+		private long currentBytes;
+		private long hitCount;
+		private long missCount;
+		private long evictionCount;
+
+		public SKImageCache ()
+			: this (DefaultMaxBytes)
+		{
+		}
+
+		public SKImageCache (long maxBytes)
+		{
+			if (maxBytes <= 0)
+				throw new ArgumentOutOfRangeException (nameof (maxBytes), "The maximum number of bytes must be greater than zero.");
+
+			this.maxBytes = maxBytes;
+		}
+
+		public long MaxBytes {
+			get {
+				lock (locker) {
+					return maxBytes;
+				}
+			}
+			set {
+				if (value <= 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The maximum number of bytes must be greater than zero.");
+
+				lock (locker) {
+					maxBytes = value;
+					Trim (null);
+				}
+			}
+		}
+
+		// the pixel bytes of all the decoded images in the cache
+		public long CurrentBytes {
+			get {
+				lock (locker) {
+					return currentBytes;
+				}
+			}
+		}
+
+		public int Count {
+			get {
+				lock (locker) {
+					return entries.Count;
+				}
+			}
+		}
+
+		public long HitCount => Interlocked.Read (ref hitCount);
+
+		public long MissCount => Interlocked.Read (ref missCount);
+
+		public long EvictionCount => Interlocked.Read (ref evictionCount);
+
+		public void ResetStatistics ()
+		{
+			Interlocked.Exchange (ref hitCount, 0);
+			Interlocked.Exchange (ref missCount, 0);
+			Interlocked.Exchange (ref evictionCount, 0);
+		}
+
+		// GetImage
+
+		public SKCachedImage GetImage (string filename) =>
+			GetImage (filename, SKSizeI.Empty);
+
+		public SKCachedImage GetImage (string filename, SKSizeI desiredSize)
+		{
+			if (filename == null)
+				throw new ArgumentNullException (nameof (filename));
+
+			return GetImage (filename, () => SKData.Create (filename), desiredSize);
+		}
+
+		public SKCachedImage GetImage (string key, Func<SKData> dataFactory) =>
+			GetImage (key, dataFactory, SKSizeI.Empty);
+
+		// the key identifies the encoded source, and the data factory is only
+		// called when the image for the key and size bucket is not cached -
+		// the returned data is disposed once the image has been decoded
+		public SKCachedImage GetImage (string key, Func<SKData> dataFactory, SKSizeI desiredSize)
+		{
+			if (key == null)
+				throw new ArgumentNullException (nameof (key));
+			if (dataFactory == null)
+				throw new ArgumentNullException (nameof (dataFactory));
+			if (desiredSize.Width < 0 || desiredSize.Height < 0)
+				throw new ArgumentOutOfRangeException (nameof (desiredSize), "The desired size must not be negative.");
+
+			var imageKey = new ImageKey (key, GetSizeBucket (desiredSize));
+
+			LinkedListNode<ImageEntry> node;
+			lock (locker) {
+				if (entries.TryGetValue (imageKey, out node)) {
+					hitCount++;
+					recentlyUsed.Remove (node);
+					recentlyUsed.AddFirst (node);
+				} else {
+					missCount++;
+					node = recentlyUsed.AddFirst (new ImageEntry (imageKey, dataFactory));
+					entries.Add (imageKey, node);
+				}
+
+				// hold a lease while decoding so the entry is not evicted
+				node.Value.Leases++;
+			}
+
+			var entry = node.Value;
+			SKImage image;
+			try {
+				// concurrent requests for the same key wait for the one decode
+				image = entry.Image.Value;
+			} catch {
+				Release (entry, failed: true);
+				throw;
+			}
+
+			if (image == null) {
+				Release (entry, failed: true);
+				return null;
+			}
+
+			lock (locker) {
+				if (!entry.IsMeasured) {
+					entry.IsMeasured = true;
+					if (!entry.IsEvicted) {
+						entry.ByteCount = image.Info.BytesSize64;
+						currentBytes += entry.ByteCount;
+						Trim (entry);
+					}
+				}
+			}
+
+			return new SKCachedImage (this, entry, image);
+		}
+
+		// Remove
+
+		// removes all the size buckets for the source
+		public int Remove (string key)
+		{
+			if (key == null)
+				throw new ArgumentNullException (nameof (key));
+
+			var removed = 0;
+			lock (locker) {
+				var node = recentlyUsed.First;
+				while (node != null) {
+					var next = node.Next;
+					if (node.Value.Key.Source == key) {
+						Evict (node);
+						removed++;
+					}
+					node = next;
+				}
+			}
+			return removed;
+		}
+
+		public void Clear ()
+		{
+			lock (locker) {
+				while (recentlyUsed.Last != null)
+					Evict (recentlyUsed.Last);
+			}
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (disposing)
+				Clear ();
+		}
+
+		// the size bucket is the next power of two of the longest side, and
+		// zero means that the image is decoded at the full size
+		internal static int GetSizeBucket (SKSizeI desiredSize)
+		{
+			var longest = Math.Max (desiredSize.Width, desiredSize.Height);
+			if (longest <= 0)
+				return 0;
+
+			var bucket = MinimumBucket;
+			while (bucket < longest && bucket < (1 << 30))
+				bucket <<= 1;
+			return bucket;
+		}
+
+		internal static SKSizeI GetTargetSize (SKSizeI size, int bucket)
+		{
+			var longest = Math.Max (size.Width, size.Height);
+			if (bucket <= 0 || longest <= bucket)
+				return size;
+
+			var scale = (float)bucket / longest;
+			return new SKSizeI (
+				Math.Max (1, (int)Math.Round (size.Width * scale)),
+				Math.Max (1, (int)Math.Round (size.Height * scale)));
+		}
+
+		// the smallest size that the codec can decode to directly that is not
+		// smaller than the target, so that the rest is only a downscale
+		internal static SKSizeI GetDecodeSize (SKCodec codec, SKSizeI targetSize)
+		{
+			var size = codec.Info.Size;
+			if (targetSize == size)
+				return size;
+
+			static bool Fits (SKSizeI scaled, SKSizeI target) =>
+				scaled.Width >= target.Width && scaled.Height >= target.Height;
+
+			// the codec picks the supported scale that is nearest, which may
+			// be smaller than the target, so then try the larger eighths
+			// that JPEG supports
+			var scale = Math.Max ((float)targetSize.Width / size.Width, (float)targetSize.Height / size.Height);
+			var scaled = codec.GetScaledDimensions (scale);
+			for (var eighths = (int)Math.Ceiling (scale * 8); !Fits (scaled, targetSize) && eighths < 8; eighths++)
+				scaled = codec.GetScaledDimensions (eighths / 8f);
+
+			return Fits (scaled, targetSize) ? scaled : size;
+		}
+
+		internal static SKImage Decode (SKData data, int bucket)
+		{
+			if (data == null)
+				return null;
+
+			using var codec = SKCodec.Create (data);
+			if (codec == null)
+				return null;
+
+			var info = codec.Info;
+			if (info.AlphaType == SKAlphaType.Unpremul)
+				info.AlphaType = SKAlphaType.Premul;
+
+			var targetSize = GetTargetSize (info.Size, bucket);
+			var decodeSize = GetDecodeSize (codec, targetSize);
+
+			using var bitmap = SKBitmap.Decode (codec, info.WithSize (decodeSize));
+			if (bitmap == null)
+				return null;
+
+			if (decodeSize == targetSize) {
+				bitmap.SetImmutable ();
+				return SKImage.FromBitmap (bitmap);
+			}
+
+			using var resized = new SKBitmap (info.WithSize (targetSize));
+			if (!bitmap.ScalePixels (resized, SKFilterQuality.Medium))
+				return null;
+
+			resized.SetImmutable ();
+			return SKImage.FromBitmap (resized);
+		}
+
+		internal void Release (ImageEntry entry, bool failed = false)
+		{
+			SKImage dispose = null;
+
+			lock (locker) {
+				entry.Leases--;
+
+				if (failed && !entry.IsEvicted && entries.TryGetValue (entry.Key, out var node) && node.Value == entry)
+					Evict (node, count: false);
+
+				if (entry.IsEvicted && entry.Leases == 0)
+					dispose = TakeImage (entry);
+			}
+
+			dispose?.Dispose ();
+		}
+
+		private void Trim (ImageEntry keep)
+		{
+			// the least recently used images that are decoded and are not
+			// being used are evicted first
+			var node = recentlyUsed.Last;
+			while (currentBytes > maxBytes && node != null) {
+				var previous = node.Previous;
+				if (node.Value != keep && node.Value.IsMeasured)
+					Evict (node);
+				node = previous;
+			}
+		}
+
+		private void Evict (LinkedListNode<ImageEntry> node, bool count = true)
+		{
+			var entry = node.Value;
+
+			recentlyUsed.Remove (node);
+			entries.Remove (entry.Key);
+
+			entry.IsEvicted = true;
+			currentBytes -= entry.ByteCount;
+			entry.ByteCount = 0;
+
+			if (count)
+				evictionCount++;
+
+			// images that are still in use are disposed when they are released
+			if (entry.Leases == 0)
+				TakeImage (entry)?.Dispose ();
+		}
+
+		private static SKImage TakeImage (ImageEntry entry)
+		{
+			if (!entry.Image.IsValueCreated)
+				return null;
+
+			try {
+				return entry.Image.Value;
+			} catch {
+				return null;
+			}
+		}
+
+		internal readonly struct ImageKey : IEquatable<ImageKey>
+		{
+			public ImageKey (string source, int bucket)
+			{
+				Source = source;
+				Bucket = bucket;
+			}
+
+			public string Source { get; }
+
+			public int Bucket { get; }
+
+			public bool Equals (ImageKey obj) =>
+				Bucket == obj.Bucket && Source == obj.Source;
+
+			public override bool Equals (object obj) =>
+				obj is ImageKey k && Equals (k);
+
+			public override int GetHashCode ()
+			{
+				var hash = new HashCode ();
+				hash.Add (Source);
+				hash.Add (Bucket);
+				return hash.ToHashCode ();
+			}
+		}
+
+		internal sealed class ImageEntry
+		{
+			public ImageEntry (ImageKey key, Func<SKData> dataFactory)
+			{
+				Key = key;
+				Image = new Lazy<SKImage> (() => {
+					using var data = dataFactory ();
+					return Decode (data, key.Bucket);
+				}, LazyThreadSafetyMode.ExecutionAndPublication);
+			}
+
+			public ImageKey Key { get; }
+
+			public Lazy<SKImage> Image { get; }
+
+			public long ByteCount { get; set; }
+
+			public int Leases { get; set; }
+
+			public bool IsMeasured { get; set; }
+
+			public bool IsEvicted { get; set; }
+		}
+	}
+
+	// A lease on an image in a SKImageCache. The image stays valid until the
+	// lease is disposed, even if the cache evicts it in the meantime.
+	public sealed class SKCachedImage : IDisposable
+	{
+		private SKImageCache cache;
+		private SKImageCache.ImageEntry entry;
+
+		internal SKCachedImage (SKImageCache cache, SKImageCache.ImageEntry entry, SKImage image)
+		{
+			this.cache = cache;
+			this.entry = entry;
+			Image = image;
+		}
+
+		public SKImage Image { get; private set; }
+
+		public void Dispose ()
+		{
+			var c = Interlocked.Exchange (ref cache, null);
+			if (c == null)
+				return;
+
+			c.Release (entry);
+			entry = null;
+			Image = null;
+		}
+	}
+}
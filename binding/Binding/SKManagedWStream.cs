@@ -5,10 +5,18 @@ using System.Runtime.InteropServices;
 
 namespace SkiaSharp
 {
-	public class SKManagedWStream : SKAbstractManagedWStream
+	public unsafe class SKManagedWStream : SKAbstractManagedWStream
 	{
+		public const int DefaultBufferSize = 64 * 1024;
+
 		private Stream stream;
 		private readonly bool disposeStream;
+		private readonly int bufferSize;
+
+		// when buffering, the many small writes from the encoders are collected
+		// here and only written to the managed stream in large blocks
+		private byte[] writeBuffer;
+		private int writeBufferCount;
 
 		public SKManagedWStream (Stream managedStream)
 			: this (managedStream, false)
@@ -16,22 +24,54 @@ namespace SkiaSharp
 		}
 
 		public SKManagedWStream (Stream managedStream, bool disposeManagedStream)
-			: this (managedStream, disposeManagedStream, true)
+			: this (managedStream, disposeManagedStream, 0, true)
+		{
+		}
+
+		public SKManagedWStream (Stream managedStream, bool disposeManagedStream, int bufferSize)
+			: this (managedStream, disposeManagedStream, bufferSize, true)
 		{
 		}
 
-		private SKManagedWStream (Stream managedStream, bool disposeManagedStream, bool owns)
+		private SKManagedWStream (Stream managedStream, bool disposeManagedStream, int bufferSize, bool owns)
 			: base (owns)
 		{
+			if (bufferSize < 0)
+				throw new ArgumentOutOfRangeException (nameof (bufferSize), "The buffer size must not be negative.");
+
 			stream = managedStream;
 			disposeStream = disposeManagedStream;
+			this.bufferSize = bufferSize;
+
+			if (bufferSize > 0)
+				writeBuffer = ArrayPool<byte>.Shared.Rent (bufferSize);
 		}
 
+		// zero means that every write goes straight to the managed stream
+		public int BufferSize => bufferSize;
+
+		// the number of times that native code wrote to this stream
+		internal long WriteCallbackCount { get; private set; }
+
+		// the number of times that this stream wrote to the managed stream
+		internal long StreamWriteCount { get; private set; }
+
+		// the number of bytes that were copied into managed memory
+		internal long BytesCopied { get; private set; }
+
 		protected override void Dispose (bool disposing) =>
 			base.Dispose (disposing);
 
 		protected override void DisposeManaged ()
 		{
+			if (writeBuffer != null) {
+				if (stream != null)
+					FlushBuffer ();
+
+				ArrayPool<byte>.Shared.Return (writeBuffer);
+				writeBuffer = null;
+			}
+
 			if (disposeStream && stream != null) {
 				stream.Dispose ();
 				stream = null;
@@ -43,22 +83,70 @@ namespace SkiaSharp
 		protected override bool OnWrite (IntPtr buffer, IntPtr size)
 		{
 			var count = (int)size;
-			using var managedBuffer = Utils.RentArray<byte> (count);
-			if (buffer != IntPtr.Zero) {
-				Marshal.Copy (buffer, (byte[])managedBuffer, 0, count);
+			WriteCallbackCount++;
+
+			if (writeBuffer != null) {
+				if (count > bufferSize - writeBufferCount)
+					FlushBuffer ();
+
+				if (count < bufferSize) {
+					var destination = new Span<byte> (writeBuffer, writeBufferCount, count);
+					if (buffer != IntPtr.Zero)
+						new ReadOnlySpan<byte> ((void*)buffer, count).CopyTo (destination);
+					else
+						destination.Clear ();
+
+					writeBufferCount += count;
+					BytesCopied += count;
+					return true;
+				}
 			}
-			stream.Write ((byte[])managedBuffer, 0, count);
+
+			// large writes go straight through without being buffered
+			WriteToStream (buffer, count);
 			return true;
 		}
 
 		protected override void OnFlush ()
 		{
+			FlushBuffer ();
 			stream.Flush ();
 		}
 
 		protected override IntPtr OnBytesWritten ()
 		{
-			return (IntPtr)stream.Position;
+			return (IntPtr)(stream.Position + writeBufferCount);
+		}
+
+		private void FlushBuffer ()
+		{
+			if (writeBufferCount == 0)
+				return;
+
+			stream.Write (writeBuffer, 0, writeBufferCount);
+			writeBufferCount = 0;
+			StreamWriteCount++;
+		}
+
+		private void WriteToStream (IntPtr buffer, int count)
+		{
+			StreamWriteCount++;
+
+#if NETSTANDARD2_1 || NETCOREAPP
+			if (buffer != IntPtr.Zero) {
+				stream.Write (new ReadOnlySpan<byte> ((void*)buffer, count));
+				return;
+			}
+#endif
+
+			using var managedBuffer = Utils.RentArray<byte> (count);
+			if (buffer != IntPtr.Zero) {
+				Marshal.Copy (buffer, (byte[])managedBuffer, 0, count);
+				BytesCopied += count;
+			} else {
+				managedBuffer.Span.Clear ();
+			}
+			stream.Write ((byte[])managedBuffer, 0, count);
 		}
 	}
 }
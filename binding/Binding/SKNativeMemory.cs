@@ -0,0 +1,154 @@
+﻿using System;
+using System.Threading;
+
+namespace SkiaSharp
+{
+	// Accounts for the native memory that is held by the bitmaps, surfaces,
+	// images and data objects that are created with their own pixels or bytes.
+	// The managed wrappers are tiny, so without this the GC has no idea how
+	// much memory is waiting on the finalizers. The total is reported to the
+	// GC as memory pressure in batches, and an optional soft limit forces a
+	// collection when the total grows past it.
+	public static class SKNativeMemory
+	{
+		// the pressure is only updated when it is off by at least this much
+		internal const long PressureBatchBytes = 1024 * 1024;
+
+		private static readonly object locker = new object ();
+
+		private static long outstandingBytes;
+		private static long reportedBytes;
+		private static long softLimit;
+		private static long nextCollectionAt;
+		private static long collectionCount;
+		private static bool isPressureReportingEnabled = true;
+
+		// the native bytes that are held by all the objects that are alive
+		public static long OutstandingBytes => Interlocked.Read (ref outstandingBytes);
+
+		public static bool IsPressureReportingEnabled {
+			get => Volatile.Read (ref isPressureReportingEnabled);
+			set {
+				lock (locker) {
+					if (isPressureReportingEnabled == value)
+						return;
+
+					Volatile.Write (ref isPressureReportingEnabled, value);
+					if (value) {
+						ReportLocked ();
+					} else {
+						var reported = Interlocked.Exchange (ref reportedBytes, 0);
+						if (reported > 0)
+							GC.RemoveMemoryPressure (reported);
+					}
+				}
+			}
+		}
+
+		// a collection is forced when the outstanding bytes grow past this
+		// limit, and then again for every quarter of the limit that the total
+		// keeps growing while the finalizers catch up, zero means no limit
+		public static long SoftLimit {
+			get => Interlocked.Read (ref softLimit);
+			set {
+				if (value < 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The soft limit must not be negative.");
+
+				lock (locker) {
+					Interlocked.Exchange (ref softLimit, value);
+					Interlocked.Exchange (ref nextCollectionAt, value);
+				}
+			}
+		}
+
+		// the number of collections that were forced by the soft limit
+		public static long CollectionCount => Interlocked.Read (ref collectionCount);
+
+		public static void ResetStatistics ()
+		{
+			Interlocked.Exchange (ref collectionCount, 0);
+		}
+
+		// the bytes that are currently reported to the GC
+		internal static long ReportedBytes => Interlocked.Read (ref reportedBytes);
+
+		// sets the number of bytes that an object holds, where the field is
+		// owned by the object and holds what was tracked before
+		internal static void Track (ref long tracked, long bytes)
+		{
+			if (bytes < 0)
+				bytes = 0;
+
+			var previous = Interlocked.Exchange (ref tracked, bytes);
+			var delta = bytes - previous;
+			if (delta == 0)
+				return;
+
+			var total = Interlocked.Add (ref outstandingBytes, delta);
+
+			Report (total);
+			CheckSoftLimit (total, delta > 0);
+		}
+
+		internal static void Release (ref long tracked) =>
+			Track (ref tracked, 0);
+
+		private static void Report (long total)
+		{
+			if (!Volatile.Read (ref isPressureReportingEnabled))
+				return;
+			if (Math.Abs (total - Interlocked.Read (ref reportedBytes)) < PressureBatchBytes)
+				return;
+
+			lock (locker) {
+				if (isPressureReportingEnabled)
+					ReportLocked ();
+			}
+		}
+
+		private static void ReportLocked ()
+		{
+			// other threads may have moved the total since, so use the latest
+			var total = Interlocked.Read (ref outstandingBytes);
+			var delta = total - reportedBytes;
+			if (Math.Abs (delta) < PressureBatchBytes)
+				return;
+
+			if (delta > 0)
+				GC.AddMemoryPressure (delta);
+			else
+				GC.RemoveMemoryPressure (-delta);
+
+			Interlocked.Exchange (ref reportedBytes, total);
+		}
+
+		private static void CheckSoftLimit (long total, bool growing)
+		{
+			var limit = Interlocked.Read (ref softLimit);
+			if (limit <= 0)
+				return;
+
+			var threshold = Interlocked.Read (ref nextCollectionAt);
+			if (total <= limit) {
+				// the finalizers have caught up, so start again from the limit
+				if (threshold != limit)
+					Interlocked.CompareExchange (ref nextCollectionAt, limit, threshold);
+				return;
+			}
+
+			if (!growing || total <= threshold)
+				return;
+
+			// only one of the threads that crossed the threshold collects
+			var next = total + Math.Max (limit / 4, PressureBatchBytes);
+			if (Interlocked.CompareExchange (ref nextCollectionAt, next, threshold) != threshold)
+				return;
+
+			Interlocked.Increment (ref collectionCount);
+
+			// the native memory is only released by the finalizers, but this
+			// must not wait for them as the caller may hold locks that they need
+			GC.Collect ();
+		}
+	}
+}
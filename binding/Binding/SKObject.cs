@@ -1,5 +1,5 @@
 ﻿using System;
-using System.Collections.Concurrent;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 using System.Threading;
 
@@ -7,41 +7,21 @@ namespace SkiaSharp
 {
 	public abstract class SKObject : SKNativeObject
 	{
-		private readonly object locker = new object ();
+		private SKObjectChildren ownedObjects;
+		private SKObjectChildren keepAliveObjects;
 
-		private ConcurrentDictionary<IntPtr, SKObject> ownedObjects;
-		private ConcurrentDictionary<IntPtr, SKObject> keepAliveObjects;
+		internal SKObject[] GetOwnedObjects () =>
+			ownedObjects.ToArray ();
 
-		internal ConcurrentDictionary<IntPtr, SKObject> OwnedObjects {
-			get {
-				if (ownedObjects == null) {
-					lock (locker) {
-						ownedObjects ??= new ConcurrentDictionary<IntPtr, SKObject> ();
-					}
-				}
-				return ownedObjects;
-			}
-		}
-
-		internal ConcurrentDictionary<IntPtr, SKObject> KeepAliveObjects {
-			get {
-				if (keepAliveObjects == null) {
-					lock (locker) {
-						keepAliveObjects ??= new ConcurrentDictionary<IntPtr, SKObject> ();
-					}
-				}
-				return keepAliveObjects;
-			}
-		}
+		internal SKObject[] GetKeepAliveObjects () =>
+			keepAliveObjects.ToArray ();
 
 		static SKObject ()
 		{
-			SkiaSharpVersion.CheckNativeLibraryCompatible (true);
-
-			SKColorSpace.EnsureStaticInstanceAreInitialized ();
-			SKData.EnsureStaticInstanceAreInitialized ();
-			SKFontManager.EnsureStaticInstanceAreInitialized ();
-			SKTypeface.EnsureStaticInstanceAreInitialized ();
+			// the static instances (SKColorSpace, SKData, SKFontManager and SKTypeface)
+			// are created lazily by the types themselves before a handle is wrapped
+			SKStartupTrace.Measure (nameof (SkiaSharpVersion.CheckNativeLibraryCompatible), () =>
+				SkiaSharpVersion.CheckNativeLibraryCompatible (true));
 		}
 
 		internal SKObject (IntPtr handle, bool owns)
@@ -67,24 +47,20 @@ namespace SkiaSharp
 
 		protected override void DisposeUnownedManaged ()
 		{
-			if (ownedObjects != null) {
-				foreach (var child in ownedObjects) {
-					if (child.Value is SKObject c && !c.OwnsHandle)
-						c.DisposeInternal ();
-				}
-			}
+			ownedObjects.ForEach (static c => {
+				if (!c.OwnsHandle)
+					c.DisposeInternal ();
+			});
 		}
 
 		protected override void DisposeManaged ()
 		{
-			if (ownedObjects != null) {
-				foreach (var child in ownedObjects) {
-					if (child.Value is SKObject c && c.OwnsHandle)
-						c.DisposeInternal ();
-				}
-				ownedObjects.Clear ();
-			}
-			keepAliveObjects?.Clear ();
+			ownedObjects.ForEach (static c => {
+				if (c.OwnsHandle)
+					c.DisposeInternal ();
+			});
+			ownedObjects.Clear ();
+			keepAliveObjects.Clear ();
 		}
 
 		protected override void DisposeNative ()
@@ -163,7 +139,7 @@ namespace SkiaSharp
 			if (newOwner == null)
 				DisposeInternal ();
 			else
-				newOwner.OwnedObjects[Handle] = this;
+				newOwner.ownedObjects.Add (Handle, this);
 		}
 
 		// indicate that the child is controlled by the native code and
@@ -172,7 +148,7 @@ namespace SkiaSharp
 			where T : SKObject
 		{
 			if (child != null) {
-				owner.OwnedObjects[child.Handle] = child;
+				owner.ownedObjects.Add (child.Handle, child);
 			}
 
 			return child;
@@ -185,7 +161,7 @@ namespace SkiaSharp
 		{
 			if (child != null) {
 				if (owner != null)
-					owner.OwnedObjects[child.Handle] = child;
+					owner.ownedObjects.Add (child.Handle, child);
 				else
 					child.Dispose ();
 			}
@@ -199,7 +175,7 @@ namespace SkiaSharp
 			where T : SKObject
 		{
 			if (child != null && owner != null)
-				owner.KeepAliveObjects[child.Handle] = child;
+				owner.keepAliveObjects.Add (child.Handle, child);
 
 			return owner;
 		}
@@ -223,6 +199,89 @@ namespace SkiaSharp
 		}
 	}
 
+	// The children of an object, without any allocations for the common
+	// cases. The field is null when there are no children, the child itself
+	// when there is only one and a dictionary, which is also the lock, once
+	// there are more. The children are disposed in the order they were added.
+	internal struct SKObjectChildren
+	{
+		private object children;
+
+		public bool IsEmpty => Volatile.Read (ref children) == null;
+
+		public void Add (IntPtr handle, SKObject child)
+		{
+			while (true) {
+				var current = Volatile.Read (ref children);
+
+				if (current == null) {
+					if (Interlocked.CompareExchange (ref children, child, null) == null)
+						return;
+				} else if (current is SKObject single) {
+					// a child with the same handle replaces the existing one
+					if (single == child)
+						return;
+					if (single.Handle == handle) {
+						if (Interlocked.CompareExchange (ref children, child, single) == single)
+							return;
+						continue;
+					}
+
+					var many = new Dictionary<IntPtr, SKObject> {
+						[single.Handle] = single,
+						[handle] = child,
+					};
+					if (Interlocked.CompareExchange (ref children, many, single) == single)
+						return;
+				} else {
+					var many = (Dictionary<IntPtr, SKObject>)current;
+					lock (many) {
+						many[handle] = child;
+					}
+					return;
+				}
+			}
+		}
+
+		public void ForEach (Action<SKObject> action)
+		{
+			var current = Volatile.Read (ref children);
+			if (current == null)
+				return;
+
+			if (current is SKObject single) {
+				action (single);
+				return;
+			}
+
+			// the children may add more children while they are disposed
+			foreach (var child in ToArray ((Dictionary<IntPtr, SKObject>)current))
+				action (child);
+		}
+
+		public void Clear () =>
+			Volatile.Write (ref children, null);
+
+		public SKObject[] ToArray ()
+		{
+			var current = Volatile.Read (ref children);
+			if (current == null)
+				return new SKObject[0];
+			if (current is SKObject single)
+				return new[] { single };
+			return ToArray ((Dictionary<IntPtr, SKObject>)current);
+		}
+
+		private static SKObject[] ToArray (Dictionary<IntPtr, SKObject> many)
+		{
+			lock (many) {
+				var array = new SKObject[many.Count];
+				many.Values.CopyTo (array, 0);
+				return array;
+			}
+		}
+	}
+
 	public abstract class SKNativeObject : IDisposable
 	{
 		internal bool fromFinalizer = false;
@@ -51,8 +51,11 @@ namespace SkiaSharp
 
 		// Reset
 
-		public void Reset () =>
+		public void Reset ()
+		{
 			SkiaApi.sk_compatpaint_reset (Handle);
+			font?.Invalidate ();
+		}
 
 		// properties
 
@@ -0,0 +1,207 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace SkiaSharp
+{
+	// Records each page into an SKPicture on the thread pool and replays the
+	// pictures into the document in page order. The document is only ever used
+	// on the thread that calls AddPage/Close, so the pages are written to the
+	// document stream as soon as the earlier pages are done.
+	public class SKParallelDocumentBuilder : IDisposable
+	{
+		private readonly SKDocument document;
+		private readonly int maxPendingPages;
+		private readonly SemaphoreSlim recordingSlots;
+		private readonly Queue<PendingPage> pending = new Queue<PendingPage> ();
+
+		private int pageCount;
+		private bool isClosed;
+
+		public SKParallelDocumentBuilder (SKDocument document)
+			: this (document, 0, 0)
+		{
+		}
+
+		public SKParallelDocumentBuilder (SKDocument document, int maxDegreeOfParallelism)
+			: this (document, maxDegreeOfParallelism, 0)
+		{
+		}
+
+		public SKParallelDocumentBuilder (SKDocument document, int maxDegreeOfParallelism, int maxPendingPages)
+		{
+			if (maxDegreeOfParallelism < 0)
+				throw new ArgumentOutOfRangeException (nameof (maxDegreeOfParallelism));
+			if (maxPendingPages < 0)
+				throw new ArgumentOutOfRangeException (nameof (maxPendingPages));
+
+			if (maxDegreeOfParallelism == 0)
+				maxDegreeOfParallelism = Environment.ProcessorCount;
+			if (maxPendingPages == 0)
+				maxPendingPages = maxDegreeOfParallelism * 2;
+			if (maxPendingPages < maxDegreeOfParallelism)
+				throw new ArgumentOutOfRangeException (nameof (maxPendingPages), "The number of pending pages must be at least the degree of parallelism.");
+
+			this.document = document ?? throw new ArgumentNullException (nameof (document));
+			this.maxPendingPages = maxPendingPages;
+
+			MaxDegreeOfParallelism = maxDegreeOfParallelism;
+			recordingSlots = new SemaphoreSlim (maxDegreeOfParallelism, maxDegreeOfParallelism);
+		}
+
+		public SKDocument Document => document;
+
+		public int MaxDegreeOfParallelism { get; }
+
+		public int MaxPendingPages => maxPendingPages;
+
+		// the number of pages that have been added to the builder
+		public int PageCount => pageCount;
+
+		// the number of pages that have been written to the document
+		public int WrittenPageCount { get; private set; }
+
+		// the most pages that were recorded but not yet written at the same time
+		public int PeakPendingPages { get; private set; }
+
+		public void AddPage (float width, float height, Action<SKCanvas> draw) =>
+			AddPage (width, height, null, draw);
+
+		public void AddPage (float width, float height, SKRect content, Action<SKCanvas> draw) =>
+			AddPage (width, height, (SKRect?)content, draw);
+
+		private void AddPage (float width, float height, SKRect? content, Action<SKCanvas> draw)
+		{
+			if (draw == null)
+				throw new ArgumentNullException (nameof (draw));
+			if (isClosed)
+				throw new InvalidOperationException ("The document builder has already been closed.");
+
+			// write out everything that is ready, and then wait for the oldest
+			// page if the window is full so that memory does not grow
+			WriteCompletedPages ();
+			while (pending.Count >= maxPendingPages)
+				WritePage (pending.Dequeue ());
+
+			var cull = content is SKRect c
+				? SKRect.Create (c.Width, c.Height)
+				: SKRect.Create (width, height);
+
+			var page = new PendingPage (width, height, content, RecordAsync (cull, draw));
+			pending.Enqueue (page);
+			pageCount++;
+
+			if (pending.Count > PeakPendingPages)
+				PeakPendingPages = pending.Count;
+		}
+
+		// waits for all the recorded pages and writes them to the document
+		public void Flush ()
+		{
+			while (pending.Count > 0)
+				WritePage (pending.Dequeue ());
+		}
+
+		// writes all the pending pages and closes the document
+		public void Close ()
+		{
+			if (isClosed)
+				return;
+
+			Flush ();
+			isClosed = true;
+			document.Close ();
+		}
+
+		// discards all the pending pages and aborts the document
+		public void Abort ()
+		{
+			if (isClosed)
+				return;
+
+			isClosed = true;
+			DiscardPendingPages ();
+			document.Abort ();
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (!disposing)
+				return;
+
+			DiscardPendingPages ();
+			recordingSlots.Dispose ();
+		}
+
+		private Task<SKPicture> RecordAsync (SKRect cull, Action<SKCanvas> draw) =>
+			Task.Run (async () => {
+				await recordingSlots.WaitAsync ().ConfigureAwait (false);
+				try {
+					using var recorder = new SKPictureRecorder ();
+					var canvas = recorder.BeginRecording (cull);
+					draw (canvas);
+					return recorder.EndRecording ();
+				} finally {
+					recordingSlots.Release ();
+				}
+			});
+
+		private void WriteCompletedPages ()
+		{
+			while (pending.Count > 0 && pending.Peek ().Picture.IsCompleted)
+				WritePage (pending.Dequeue ());
+		}
+
+		private void WritePage (PendingPage page)
+		{
+			// this rethrows any exception from the page drawing code
+			using var picture = page.Picture.GetAwaiter ().GetResult ();
+
+			var canvas = page.Content is SKRect content
+				? document.BeginPage (page.Width, page.Height, content)
+				: document.BeginPage (page.Width, page.Height);
+			canvas.DrawPicture (picture);
+			document.EndPage ();
+
+			WrittenPageCount++;
+		}
+
+		private void DiscardPendingPages ()
+		{
+			while (pending.Count > 0) {
+				var page = pending.Dequeue ();
+				try {
+					page.Picture.GetAwaiter ().GetResult ()?.Dispose ();
+				} catch {
+					// the page failed, but it is being thrown away anyway
+				}
+			}
+		}
+
+		private readonly struct PendingPage
+		{
+			public PendingPage (float width, float height, SKRect? content, Task<SKPicture> picture)
+			{
+				Width = width;
+				Height = height;
+				Content = content;
+				Picture = picture;
+			}
+
+			public float Width { get; }
+
+			public float Height { get; }
+
+			public SKRect? Content { get; }
+
+			public Task<SKPicture> Picture { get; }
+		}
+	}
+}
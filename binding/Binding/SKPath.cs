@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using System.ComponentModel;
 
 namespace SkiaSharp
@@ -419,6 +420,22 @@ namespace SkiaSharp
 			}
 		}
 
+		// combines all the paths, resolving groups of nearby paths on several
+		// threads and then combining the groups - returns null if the path ops
+		// failed, just like Op
+
+		public static SKPath Union (IReadOnlyList<SKPath> paths) =>
+			SKPathCombiner.Combine (paths, SKPathOp.Union, 0);
+
+		public static SKPath Union (IReadOnlyList<SKPath> paths, int maxDegreeOfParallelism) =>
+			SKPathCombiner.Combine (paths, SKPathOp.Union, maxDegreeOfParallelism);
+
+		public static SKPath Intersect (IReadOnlyList<SKPath> paths) =>
+			SKPathCombiner.Combine (paths, SKPathOp.Intersect, 0);
+
+		public static SKPath Intersect (IReadOnlyList<SKPath> paths, int maxDegreeOfParallelism) =>
+			SKPathCombiner.Combine (paths, SKPathOp.Intersect, maxDegreeOfParallelism);
+
 		public bool Simplify (SKPath result)
 		{
 			if (result == null)
@@ -0,0 +1,171 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace SkiaSharp
+{
+	// Combines many paths with the same operation. The paths are sorted along
+	// a Z-order curve so that paths that are close together end up in the same
+	// group, each group is resolved with its own OpBuilder, and then the
+	// results are combined in pairs until there is only one left. The groups
+	// and every level of the pairs are spread over the threads.
+	internal static class SKPathCombiner
+	{
+		private const int MinimumGroupSize = 8;
+		private const int MaximumGroupSize = 128;
+
+		// fewer paths than this are not worth the threads
+		private const int MinimumParallelCount = 64;
+
+		public static SKPath Combine (IReadOnlyList<SKPath> paths, SKPathOp op, int maxDegreeOfParallelism)
+		{
+			if (paths == null)
+				throw new ArgumentNullException (nameof (paths));
+			if (maxDegreeOfParallelism < 0)
+				throw new ArgumentOutOfRangeException (nameof (maxDegreeOfParallelism));
+			if (op != SKPathOp.Union && op != SKPathOp.Intersect)
+				throw new ArgumentOutOfRangeException (nameof (op), "Only the union and the intersection can be done in any order.");
+
+			var count = paths.Count;
+			if (count == 0)
+				return new SKPath ();
+
+			if (maxDegreeOfParallelism == 0)
+				maxDegreeOfParallelism = Environment.ProcessorCount;
+			if (count < MinimumParallelCount)
+				maxDegreeOfParallelism = 1;
+
+			// the bounds are computed lazily by the native path, so do it here
+			// before any of the threads read the paths
+			var bounds = new SKRect[count];
+			var total = SKRect.Empty;
+			var common = SKRect.Empty;
+			for (var i = 0; i < count; i++) {
+				var path = paths[i] ?? throw new ArgumentException ("The list of paths must not contain null paths.", nameof (paths));
+				bounds[i] = path.Bounds;
+
+				if (i == 0) {
+					total = bounds[i];
+					common = bounds[i];
+				} else {
+					total.Union (bounds[i]);
+					common.Intersect (bounds[i]);
+				}
+			}
+
+			// nothing can overlap all of the paths
+			if (op == SKPathOp.Intersect && common.IsEmpty)
+				return new SKPath ();
+
+			var order = GetSpatialOrder (bounds, total);
+
+			var groupSize = count / (maxDegreeOfParallelism * 4);
+			groupSize = Math.Max (MinimumGroupSize, Math.Min (MaximumGroupSize, groupSize));
+			var groupCount = (count + groupSize - 1) / groupSize;
+
+			var results = new SKPath[groupCount];
+			try {
+				Utils.ParallelFor (groupCount, maxDegreeOfParallelism, g => {
+					var start = g * groupSize;
+					var end = Math.Min (count, start + groupSize);
+
+					using var builder = new SKPath.OpBuilder ();
+					for (var i = start; i < end; i++)
+						builder.Add (paths[order[i]], i == start ? SKPathOp.Union : op);
+
+					var result = new SKPath ();
+					if (builder.Resolve (result)) {
+						results[g] = result;
+					} else {
+						result.Dispose ();
+						throw new PathOpFailedException ();
+					}
+				});
+
+				// combine neighbours, which are also close together
+				while (results.Length > 1) {
+					var current = results;
+					var next = new SKPath[(current.Length + 1) / 2];
+
+					try {
+						Utils.ParallelFor (next.Length, maxDegreeOfParallelism, p => {
+							var left = current[p * 2];
+							var right = p * 2 + 1 < current.Length ? current[p * 2 + 1] : null;
+							if (right == null) {
+								next[p] = left;
+								current[p * 2] = null;
+								return;
+							}
+
+							var result = new SKPath ();
+							if (left.Op (right, op, result)) {
+								next[p] = result;
+							} else {
+								result.Dispose ();
+								throw new PathOpFailedException ();
+							}
+						});
+					} catch {
+						Dispose (next);
+						throw;
+					}
+
+					Dispose (current);
+					results = next;
+				}
+
+				var combined = results[0];
+				results[0] = null;
+				return combined;
+			} catch (PathOpFailedException) {
+				return null;
+			} finally {
+				Dispose (results);
+			}
+		}
+
+		// sorts the paths by the Z-order of the center of their bounds
+		internal static int[] GetSpatialOrder (SKRect[] bounds, SKRect total)
+		{
+			var count = bounds.Length;
+			var order = new int[count];
+			var keys = new ulong[count];
+
+			var scaleX = total.Width > 0 ? ushort.MaxValue / total.Width : 0;
+			var scaleY = total.Height > 0 ? ushort.MaxValue / total.Height : 0;
+
+			for (var i = 0; i < count; i++) {
+				var x = (uint)Math.Max (0, Math.Min (ushort.MaxValue, (bounds[i].MidX - total.Left) * scaleX));
+				var y = (uint)Math.Max (0, Math.Min (ushort.MaxValue, (bounds[i].MidY - total.Top) * scaleY));
+
+				// the index breaks ties so that the order is always the same
+				keys[i] = ((ulong)(Interleave (x) | (Interleave (y) << 1)) << 32) | (uint)i;
+				order[i] = i;
+			}
+
+			Array.Sort (keys, order);
+			return order;
+		}
+
+		private static uint Interleave (uint value)
+		{
+			value &= 0xFFFF;
+			value = (value | (value << 8)) & 0x00FF00FF;
+			value = (value | (value << 4)) & 0x0F0F0F0F;
+			value = (value | (value << 2)) & 0x33333333;
+			value = (value | (value << 1)) & 0x55555555;
+			return value;
+		}
+
+		private static void Dispose (SKPath[] paths)
+		{
+			for (var i = 0; i < paths.Length; i++) {
+				paths[i]?.Dispose ();
+				paths[i] = null;
+			}
+		}
+
+		private sealed class PathOpFailedException : Exception
+		{
+		}
+	}
+}
@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 
 namespace SkiaSharp
 {
@@ -118,6 +119,171 @@ namespace SkiaSharp
 			}
 		}
 
+		// GetPositionsAndTangents (batch)
+
+		// an empty position or tangent span means that it is not needed
+
+		public bool GetPositionsAndTangents (ReadOnlySpan<float> distances, Span<SKPoint> positions, Span<SKPoint> tangents)
+		{
+			ValidateOutputs (distances.Length, positions.Length, nameof (positions), tangents.Length, nameof (tangents));
+
+			var success = true;
+			fixed (float* d = distances)
+			fixed (SKPoint* p = positions)
+			fixed (SKPoint* t = tangents) {
+				for (var i = 0; i < distances.Length; i++)
+					success &= SkiaApi.sk_pathmeasure_get_pos_tan (Handle, d[i], p == null ? null : p + i, t == null ? null : t + i);
+			}
+			return success;
+		}
+
+		public bool GetPositionsAndTangents (float start, float step, int count, Span<SKPoint> positions, Span<SKPoint> tangents)
+		{
+			if (count < 0)
+				throw new ArgumentOutOfRangeException (nameof (count));
+			ValidateOutputs (count, positions.Length, nameof (positions), tangents.Length, nameof (tangents));
+
+			var success = true;
+			fixed (SKPoint* p = positions)
+			fixed (SKPoint* t = tangents) {
+				for (var i = 0; i < count; i++)
+					success &= SkiaApi.sk_pathmeasure_get_pos_tan (Handle, start + step * i, p == null ? null : p + i, t == null ? null : t + i);
+			}
+			return success;
+		}
+
+		// the distances are along all the contours of the path, one after the
+		// other, instead of just along the current contour
+		public static bool GetPositionsAndTangents (SKPath path, ReadOnlySpan<float> distances, Span<SKPoint> positions, Span<SKPoint> tangents, bool forceClosed = false)
+		{
+			if (path == null)
+				throw new ArgumentNullException (nameof (path));
+			ValidateOutputs (distances.Length, positions.Length, nameof (positions), tangents.Length, nameof (tangents));
+
+			if (distances.Length == 0)
+				return true;
+
+			// the contours can only be measured one after the other
+			var lengths = GetContourLengths (path, forceClosed);
+			if (lengths.Count == 0)
+				return false;
+
+			using var order = Utils.RentArray<int> (distances.Length);
+			using var keys = Utils.RentArray<float> (distances.Length);
+			var sorted = true;
+			for (var i = 0; i < distances.Length; i++) {
+				order[i] = i;
+				keys[i] = distances[i];
+				if (i > 0 && distances[i] < distances[i - 1])
+					sorted = false;
+			}
+			if (!sorted)
+				Array.Sort (keys.Array, order.Array, 0, distances.Length);
+
+			using var measure = new SKPathMeasure (path, forceClosed);
+			var contour = 0;
+			var contourStart = 0f;
+
+			var success = true;
+			fixed (SKPoint* p = positions)
+			fixed (SKPoint* t = tangents) {
+				for (var i = 0; i < distances.Length; i++) {
+					var index = order[i];
+					var distance = keys[i];
+
+					while (contour < lengths.Count - 1 && distance >= contourStart + lengths[contour]) {
+						contourStart += lengths[contour];
+						contour++;
+						measure.NextContour ();
+					}
+
+					success &= SkiaApi.sk_pathmeasure_get_pos_tan (measure.Handle, distance - contourStart, p == null ? null : p + index, t == null ? null : t + index);
+				}
+			}
+			return success;
+		}
+
+		// the length of all the contours of the path
+		public static float GetTotalLength (SKPath path, bool forceClosed = false)
+		{
+			if (path == null)
+				throw new ArgumentNullException (nameof (path));
+
+			var total = 0f;
+			foreach (var length in GetContourLengths (path, forceClosed))
+				total += length;
+			return total;
+		}
+
+		// fills the distances with samples that are evenly spaced along a
+		// length, starting at the offset, and returns the number of samples
+		// that are needed to cover the whole length - which may be more than
+		// the span can hold
+		public static int GetEvenlySpacedDistances (float length, float spacing, float offset, Span<float> distances)
+		{
+			if (spacing <= 0)
+				throw new ArgumentOutOfRangeException (nameof (spacing), "The spacing must be greater than zero.");
+			if (length < 0 || offset < 0 || offset > length)
+				return 0;
+
+			var count = (int)Math.Min (int.MaxValue, Math.Floor ((length - offset) / spacing) + 1);
+			var filled = Math.Min (count, distances.Length);
+			for (var i = 0; i < filled; i++)
+				distances[i] = offset + spacing * i;
+			return count;
+		}
+
+		// GetMatrices (batch)
+
+		public bool GetMatrices (ReadOnlySpan<float> distances, Span<SKMatrix> matrices, SKPathMeasureMatrixFlags flags)
+		{
+			if (matrices.Length < distances.Length)
+				throw new ArgumentException ("The span of matrices must be at least as long as the distances.", nameof (matrices));
+
+			var success = true;
+			fixed (float* d = distances)
+			fixed (SKMatrix* m = matrices) {
+				for (var i = 0; i < distances.Length; i++)
+					success &= SkiaApi.sk_pathmeasure_get_matrix (Handle, d[i], m + i, flags);
+			}
+			return success;
+		}
+
+		public bool GetMatrices (float start, float step, int count, Span<SKMatrix> matrices, SKPathMeasureMatrixFlags flags)
+		{
+			if (count < 0)
+				throw new ArgumentOutOfRangeException (nameof (count));
+			if (matrices.Length < count)
+				throw new ArgumentException ("The span of matrices must be at least as long as the count.", nameof (matrices));
+
+			var success = true;
+			fixed (SKMatrix* m = matrices) {
+				for (var i = 0; i < count; i++)
+					success &= SkiaApi.sk_pathmeasure_get_matrix (Handle, start + step * i, m + i, flags);
+			}
+			return success;
+		}
+
+		private static void ValidateOutputs (int count, int positions, string positionsName, int tangents, string tangentsName)
+		{
+			if (positions != 0 && positions < count)
+				throw new ArgumentException ("The span of positions must be empty or at least as long as the number of samples.", positionsName);
+			if (tangents != 0 && tangents < count)
+				throw new ArgumentException ("The span of tangents must be empty or at least as long as the number of samples.", tangentsName);
+		}
+
+		private static List<float> GetContourLengths (SKPath path, bool forceClosed)
+		{
+			var lengths = new List<float> ();
+			using var measure = new SKPathMeasure (path, forceClosed);
+			do {
+				var length = measure.Length;
+				if (length > 0)
+					lengths.Add (length);
+			} while (measure.NextContour ());
+			return lengths;
+		}
+
 		// GetSegment
 
 		public bool GetSegment (float start, float stop, SKPath dst, bool startWithMoveTo)
@@ -34,7 +34,7 @@ namespace SkiaSharp
 			if (stream == null)
 				throw new ArgumentNullException (nameof (stream));
 
-			using var managed = new SKManagedWStream (stream);
+			using var managed = new SKManagedWStream (stream, false, SKManagedWStream.DefaultBufferSize);
 			Serialize (managed);
 		}
 
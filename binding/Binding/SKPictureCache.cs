@@ -0,0 +1,859 @@
+﻿using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using System.Threading;
+
+namespace SkiaSharp
+{
+	// A thread-safe cache of serialized pictures on disk that survives the
+	// process, so that static content is only recorded once. The pictures are
+	// appended to segment files, and read back by memory-mapping the segment
+	// and deserializing straight from the mapping. The cache is bounded by
+	// the size of the files: the least recently used pictures are evicted
+	// first, empty segments are deleted, and the live pictures of the oldest
+	// segment are moved to the newest one when the dead space needs to be
+	// reclaimed. The pictures that are removed or evicted are hidden by
+	// tombstones, which are moved forward while older segments still have
+	// records for them, and the order of use is saved when the cache is
+	// disposed. Only one cache at a time can use a directory.
+	public class SKPictureCache : IDisposable
+	{
+		public const long DefaultMaxBytes = 256 * 1024 * 1024;
+
+		private const string SegmentExtension = ".skpc";
+		private const string LockFileName = "lock";
+		private const string RecencyFileName = "recency";
+
+		private const uint SegmentMagic = 0x43504B53; // SKPC
+		private const uint SegmentVersion = 1;
+		private const int SegmentHeaderSize = 8;
+
+		private const uint RecordMagic = 0x52504B53; // SKPR
+		private const int RecordHeaderSize = 24;
+		private const int RemovedLength = -1;
+
+		private const uint RecencyMagic = 0x4C504B53; // SKPL
+		private const int RecencyHeaderSize = 8;
+		private const int RecencyKeySize = 16;
+
+		// the budget is split over about this many segments
+		private const int SegmentsPerBudget = 8;
+		private const long MinimumSegmentSize = 64 * 1024;
+
+		private readonly object locker = new object ();
+		private readonly Dictionary<SKPictureCacheKey, LinkedListNode<Entry>> entries = new Dictionary<SKPictureCacheKey, LinkedListNode<Entry>> ();
+		private readonly LinkedList<Entry> recentlyUsed = new LinkedList<Entry> ();
+		private readonly List<Segment> segments = new List<Segment> ();
+		private readonly List<string> pendingDeletes = new List<string> ();
+
+		private FileStream lockFile;
+		private FileStream writer;
+		private Segment current;
+		private int nextSegmentId;
+
+		private long maxBytes;
+		private long liveBytes;
+		private long hitCount;
+		private long missCount;
+		private long evictionCount;
+
+		public SKPictureCache (string directory)
+			: this (directory, DefaultMaxBytes)
+		{
+		}
+
+		public SKPictureCache (string directory, long maxBytes)
+		{
+			if (string.IsNullOrEmpty (directory))
+				throw new ArgumentException ("The directory cannot be empty.", nameof (directory));
+			if (maxBytes <= 0)
+				throw new ArgumentOutOfRangeException (nameof (maxBytes), "The maximum number of bytes must be greater than zero.");
+
+			Directory = directory;
+			this.maxBytes = maxBytes;
+
+			System.IO.Directory.CreateDirectory (directory);
+			try {
+				lockFile = new FileStream (Path.Combine (directory, LockFileName), FileMode.OpenOrCreate, FileAccess.ReadWrite, FileShare.None);
+			} catch (IOException ex) {
+				throw new IOException ("The picture cache directory is already in use.", ex);
+			}
+
+			try {
+				Load ();
+			} catch {
+				Dispose ();
+				throw;
+			}
+		}
+
+		public string Directory { get; }
+
+		public long MaxBytes {
+			get {
+				lock (locker) {
+					return maxBytes;
+				}
+			}
+			set {
+				if (value <= 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The maximum number of bytes must be greater than zero.");
+
+				lock (locker) {
+					maxBytes = value;
+					Trim ();
+				}
+			}
+		}
+
+		// the size of the segment files, including the space that is not
+		// reclaimed yet
+		public long CurrentBytes {
+			get {
+				lock (locker) {
+					return GetTotalBytes ();
+				}
+			}
+		}
+
+		public int Count {
+			get {
+				lock (locker) {
+					return entries.Count;
+				}
+			}
+		}
+
+		public long HitCount => Interlocked.Read (ref hitCount);
+
+		public long MissCount => Interlocked.Read (ref missCount);
+
+		public long EvictionCount => Interlocked.Read (ref evictionCount);
+
+		public void ResetStatistics ()
+		{
+			Interlocked.Exchange (ref hitCount, 0);
+			Interlocked.Exchange (ref missCount, 0);
+			Interlocked.Exchange (ref evictionCount, 0);
+		}
+
+		public bool Contains (SKPictureCacheKey key)
+		{
+			lock (locker) {
+				return entries.ContainsKey (key);
+			}
+		}
+
+		// returns a new picture that the caller owns, or null if there is no
+		// picture for the key
+		public SKPicture GetPicture (SKPictureCacheKey key)
+		{
+			Entry entry;
+			SKData slice;
+
+			lock (locker) {
+				ThrowIfDisposed ();
+
+				if (!entries.TryGetValue (key, out var node)) {
+					Interlocked.Increment (ref missCount);
+					return null;
+				}
+
+				recentlyUsed.Remove (node);
+				recentlyUsed.AddFirst (node);
+
+				entry = node.Value;
+				slice = GetSlice (entry);
+			}
+
+			// the picture copies what it needs, so the mapping is not kept
+			// and the deserialization does not need the lock
+			SKPicture picture;
+			using (slice)
+				picture = slice == null ? null : SKPicture.Deserialize (slice);
+
+			if (picture == null) {
+				// the file was damaged, so do not try again
+				lock (locker) {
+					if (lockFile != null && entries.TryGetValue (key, out var node) && node.Value == entry) {
+						Drop (entry);
+						writer?.Flush ();
+					}
+				}
+				Interlocked.Increment (ref missCount);
+			} else {
+				Interlocked.Increment (ref hitCount);
+			}
+
+			return picture;
+		}
+
+		// records the picture if it is not in the cache yet
+		public SKPicture GetPicture (SKPictureCacheKey key, Func<SKPicture> recorder)
+		{
+			if (recorder == null)
+				throw new ArgumentNullException (nameof (recorder));
+
+			var picture = GetPicture (key);
+			if (picture != null)
+				return picture;
+
+			picture = recorder ();
+			if (picture != null)
+				Add (key, picture);
+			return picture;
+		}
+
+		// returns false if the picture is too large to be cached
+		public bool Add (SKPictureCacheKey key, SKPicture picture)
+		{
+			if (picture == null)
+				throw new ArgumentNullException (nameof (picture));
+
+			using var data = picture.Serialize ();
+			return Add (key, data);
+		}
+
+		// the data must be a serialized picture
+		public bool Add (SKPictureCacheKey key, SKData data)
+		{
+			if (data == null)
+				throw new ArgumentNullException (nameof (data));
+
+			lock (locker) {
+				ThrowIfDisposed ();
+
+				// do not let a single picture take over the whole cache
+				var length = data.Size;
+				if (length == 0 || length > maxBytes / 4 || length > int.MaxValue - RecordHeaderSize)
+					return false;
+
+				if (entries.TryGetValue (key, out var existing))
+					Forget (existing.Value);
+
+				var entry = Append (key, data);
+				entry.Node = recentlyUsed.AddFirst (entry);
+				entries[key] = entry.Node;
+				liveBytes += entry.Length + RecordHeaderSize;
+
+				writer.Flush ();
+				Trim ();
+				return true;
+			}
+		}
+
+		public bool Remove (SKPictureCacheKey key)
+		{
+			lock (locker) {
+				ThrowIfDisposed ();
+
+				if (!entries.TryGetValue (key, out var node))
+					return false;
+
+				Drop (node.Value);
+				writer.Flush ();
+
+				Trim ();
+				return true;
+			}
+		}
+
+		public void Clear ()
+		{
+			lock (locker) {
+				ThrowIfDisposed ();
+
+				entries.Clear ();
+				recentlyUsed.Clear ();
+				liveBytes = 0;
+
+				CloseWriter ();
+				foreach (var segment in segments)
+					DeleteSegment (segment);
+				segments.Clear ();
+			}
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (!disposing)
+				return;
+
+			lock (locker) {
+				if (lockFile == null)
+					return;
+
+				SaveRecency ();
+
+				CloseWriter ();
+				foreach (var segment in segments) {
+					segment.Mapping?.Dispose ();
+					segment.Mapping = null;
+				}
+
+				lockFile.Dispose ();
+				lockFile = null;
+			}
+		}
+
+		private void ThrowIfDisposed ()
+		{
+			if (lockFile == null)
+				throw new ObjectDisposedException (nameof (SKPictureCache));
+		}
+
+		private long GetTotalBytes ()
+		{
+			var total = 0L;
+			foreach (var segment in segments)
+				total += segment.Length;
+			return total;
+		}
+
+		private long GetSegmentSize () =>
+			Math.Max (MinimumSegmentSize, maxBytes / SegmentsPerBudget);
+
+		// a view of the picture in the mapped segment, which keeps the mapping
+		// alive for as long as it is needed
+		private SKData GetSlice (Entry entry)
+		{
+			var segment = entry.Segment;
+			var end = entry.Offset + entry.Length;
+
+			// the mapping does not see anything that was appended after it
+			if (segment.Mapping == null || segment.Mapping.Size < end) {
+				segment.Mapping?.Dispose ();
+				segment.Mapping = SKData.Create (segment.Path);
+				if (segment.Mapping == null || segment.Mapping.Size < end)
+					return null;
+			}
+
+			return segment.Mapping.Subset ((ulong)entry.Offset, (ulong)entry.Length);
+		}
+
+		private Entry Append (SKPictureCacheKey key, SKData data)
+		{
+			var length = (int)data.Size;
+			var recordSize = RecordHeaderSize + length;
+
+			if (current == null || (current.Length + recordSize > GetSegmentSize () && current.Length > SegmentHeaderSize))
+				StartSegment ();
+
+			WriteRecordHeader (key, length);
+			data.SaveTo (writer);
+
+			var entry = new Entry (key, current, current.Length + RecordHeaderSize, length);
+			current.Length += recordSize;
+			current.LiveCount++;
+			current.Keys.Add (key);
+			return entry;
+		}
+
+		private void WriteTombstone (SKPictureCacheKey key)
+		{
+			if (current == null || current.Length + RecordHeaderSize > GetSegmentSize ())
+				StartSegment ();
+
+			WriteRecordHeader (key, RemovedLength);
+			current.Length += RecordHeaderSize;
+			current.Tombstones.Add (key);
+		}
+
+		private void WriteRecordHeader (SKPictureCacheKey key, int length)
+		{
+			if (current == null)
+				StartSegment ();
+
+			var header = new byte[RecordHeaderSize];
+			BinaryPrimitives.WriteUInt32LittleEndian (header.AsSpan (0), RecordMagic);
+			BinaryPrimitives.WriteInt32LittleEndian (header.AsSpan (4), length);
+			BinaryPrimitives.WriteUInt64LittleEndian (header.AsSpan (8), key.High);
+			BinaryPrimitives.WriteUInt64LittleEndian (header.AsSpan (16), key.Low);
+			writer.Write (header, 0, header.Length);
+		}
+
+		private void StartSegment ()
+		{
+			CloseWriter ();
+
+			var segment = new Segment (nextSegmentId, GetSegmentPath (nextSegmentId));
+			nextSegmentId++;
+
+			writer = new FileStream (segment.Path, FileMode.Create, FileAccess.Write, FileShare.ReadWrite | FileShare.Delete);
+
+			var header = new byte[SegmentHeaderSize];
+			BinaryPrimitives.WriteUInt32LittleEndian (header.AsSpan (0), SegmentMagic);
+			BinaryPrimitives.WriteUInt32LittleEndian (header.AsSpan (4), SegmentVersion);
+			writer.Write (header, 0, header.Length);
+			segment.Length = SegmentHeaderSize;
+
+			segments.Add (segment);
+			current = segment;
+		}
+
+		private void CloseWriter ()
+		{
+			writer?.Dispose ();
+			writer = null;
+			current = null;
+		}
+
+		// drops the entry, and writes a tombstone so that the record does not
+		// come back the next time that the cache is opened
+		private void Drop (Entry entry)
+		{
+			Forget (entry);
+			WriteTombstone (entry.Key);
+		}
+
+		// drops the entry, but leaves its bytes in the segment
+		private void Forget (Entry entry)
+		{
+			entries.Remove (entry.Key);
+			recentlyUsed.Remove (entry.Node);
+			entry.Segment.LiveCount--;
+			liveBytes -= entry.Length + RecordHeaderSize;
+		}
+
+		private void Trim ()
+		{
+			RetryPendingDeletes ();
+
+			if (GetTotalBytes () <= maxBytes)
+				return;
+
+			// evict the pictures that were used the longest time ago, leaving
+			// room for the segment that is being written, for the tombstones
+			// and for the headers of the segments that the pictures may end
+			// up in
+			var target = maxBytes - GetSegmentSize () - GetSegmentSize () / 4;
+			while (liveBytes + SegmentHeaderSize * (entries.Count + 2L) > target && recentlyUsed.Last != null) {
+				Drop (recentlyUsed.Last.Value);
+				Interlocked.Increment (ref evictionCount);
+			}
+
+			// the segments without pictures can just go
+			for (var i = segments.Count - 1; i >= 0; i--) {
+				var segment = segments[i];
+				if (segment.LiveCount == 0 && segment != current)
+					Retire (segment);
+			}
+
+			// move the pictures out of the oldest segments until the dead
+			// space has been reclaimed, but only once per segment so that
+			// this cannot go around in circles
+			var compactions = segments.Count - 1;
+			while (GetTotalBytes () > maxBytes && compactions-- > 0 && segments[0] != current)
+				Compact (segments[0]);
+
+			writer?.Flush ();
+		}
+
+		private void Compact (Segment segment)
+		{
+			var moving = new List<Entry> ();
+			foreach (var entry in recentlyUsed) {
+				if (entry.Segment == segment)
+					moving.Add (entry);
+			}
+
+			foreach (var entry in moving) {
+				using var slice = GetSlice (entry);
+				if (slice == null) {
+					Drop (entry);
+					continue;
+				}
+
+				var moved = Append (entry.Key, slice);
+				moved.Node = entry.Node;
+				entry.Node.Value = moved;
+				entries[entry.Key] = moved.Node;
+				segment.LiveCount--;
+			}
+
+			Retire (segment);
+			writer?.Flush ();
+		}
+
+		// deletes a segment that is not the current one, but first moves the
+		// tombstones that still hide records in the other segments forward
+		private void Retire (Segment segment)
+		{
+			segments.Remove (segment);
+
+			foreach (var key in segment.Tombstones) {
+				if (entries.ContainsKey (key) || current?.Tombstones.Contains (key) == true)
+					continue;
+
+				foreach (var other in segments) {
+					if (other.Keys.Contains (key)) {
+						WriteTombstone (key);
+						break;
+					}
+				}
+			}
+
+			DeleteSegment (segment);
+		}
+
+		private void DeleteSegment (Segment segment)
+		{
+			segment.Mapping?.Dispose ();
+			segment.Mapping = null;
+
+			try {
+				File.Delete (segment.Path);
+			} catch (IOException) {
+				// a picture that is being read still has it mapped
+				pendingDeletes.Add (segment.Path);
+			} catch (UnauthorizedAccessException) {
+				pendingDeletes.Add (segment.Path);
+			}
+		}
+
+		private void RetryPendingDeletes ()
+		{
+			for (var i = pendingDeletes.Count - 1; i >= 0; i--) {
+				try {
+					File.Delete (pendingDeletes[i]);
+					pendingDeletes.RemoveAt (i);
+				} catch (IOException) {
+				} catch (UnauthorizedAccessException) {
+				}
+			}
+		}
+
+		private string GetSegmentPath (int id) =>
+			Path.Combine (Directory, id.ToString ("D8") + SegmentExtension);
+
+		// rebuilds the index from the segments, where the later records
+		// replace the earlier ones
+		private void Load ()
+		{
+			var files = new SortedDictionary<int, string> ();
+			foreach (var file in System.IO.Directory.GetFiles (Directory, "*" + SegmentExtension)) {
+				if (int.TryParse (Path.GetFileNameWithoutExtension (file), out var id))
+					files[id] = file;
+			}
+
+			var header = new byte[RecordHeaderSize];
+			foreach (var pair in files) {
+				var id = pair.Key;
+				var path = pair.Value;
+				nextSegmentId = id + 1;
+
+				var segment = new Segment (id, path);
+				using (var reader = new FileStream (path, FileMode.Open, FileAccess.ReadWrite, FileShare.Read)) {
+					if (!ReadFully (reader, header, SegmentHeaderSize) ||
+						BinaryPrimitives.ReadUInt32LittleEndian (header) != SegmentMagic ||
+						BinaryPrimitives.ReadUInt32LittleEndian (header.AsSpan (4)) != SegmentVersion) {
+						reader.Dispose ();
+						DeleteSegment (segment);
+						continue;
+					}
+
+					var position = (long)SegmentHeaderSize;
+					var fileLength = reader.Length;
+					while (ReadFully (reader, header, RecordHeaderSize)) {
+						var length = BinaryPrimitives.ReadInt32LittleEndian (header.AsSpan (4));
+						if (BinaryPrimitives.ReadUInt32LittleEndian (header) != RecordMagic || length < RemovedLength)
+							break;
+
+						var payload = Math.Max (0, length);
+						if (position + RecordHeaderSize + payload > fileLength)
+							break;
+
+						var key = new SKPictureCacheKey (
+							BinaryPrimitives.ReadUInt64LittleEndian (header.AsSpan (8)),
+							BinaryPrimitives.ReadUInt64LittleEndian (header.AsSpan (16)));
+
+						if (entries.TryGetValue (key, out var existing))
+							Forget (existing.Value);
+
+						if (length == RemovedLength) {
+							segment.Tombstones.Add (key);
+						} else {
+							segment.Keys.Add (key);
+							var entry = new Entry (key, segment, position + RecordHeaderSize, length);
+							entry.Node = recentlyUsed.AddFirst (entry);
+							entries[key] = entry.Node;
+							segment.LiveCount++;
+							liveBytes += length + RecordHeaderSize;
+						}
+
+						position += RecordHeaderSize + payload;
+						reader.Position = position;
+					}
+
+					// drop anything that was only partly written
+					if (position < fileLength)
+						reader.SetLength (position);
+					segment.Length = position;
+				}
+
+				segments.Add (segment);
+			}
+
+			RestoreRecency ();
+
+			// keep appending to the last segment if there is room
+			var last = segments.Count > 0 ? segments[segments.Count - 1] : null;
+			if (last != null && last.Length < GetSegmentSize ()) {
+				writer = new FileStream (last.Path, FileMode.Append, FileAccess.Write, FileShare.ReadWrite | FileShare.Delete);
+				current = last;
+			}
+
+			Trim ();
+		}
+
+		// the keys of the pictures, from the most recently used
+		private void SaveRecency ()
+		{
+			var bytes = new byte[RecencyHeaderSize + RecencyKeySize * entries.Count];
+			BinaryPrimitives.WriteUInt32LittleEndian (bytes.AsSpan (0), RecencyMagic);
+			BinaryPrimitives.WriteInt32LittleEndian (bytes.AsSpan (4), entries.Count);
+
+			var position = RecencyHeaderSize;
+			foreach (var entry in recentlyUsed) {
+				BinaryPrimitives.WriteUInt64LittleEndian (bytes.AsSpan (position), entry.Key.High);
+				BinaryPrimitives.WriteUInt64LittleEndian (bytes.AsSpan (position + 8), entry.Key.Low);
+				position += RecencyKeySize;
+			}
+
+			try {
+				using var stream = new FileStream (Path.Combine (Directory, RecencyFileName), FileMode.Create, FileAccess.Write, FileShare.None);
+				stream.Write (bytes, 0, bytes.Length);
+			} catch (IOException) {
+				// the order is only a hint
+			} catch (UnauthorizedAccessException) {
+			}
+		}
+
+		// puts the pictures back in the order that was saved, where the
+		// pictures that were added after it are the most recently used
+		private void RestoreRecency ()
+		{
+			byte[] bytes;
+			try {
+				var path = Path.Combine (Directory, RecencyFileName);
+				if (!File.Exists (path))
+					return;
+				bytes = File.ReadAllBytes (path);
+			} catch (IOException) {
+				return;
+			} catch (UnauthorizedAccessException) {
+				return;
+			}
+
+			if (bytes.Length < RecencyHeaderSize || BinaryPrimitives.ReadUInt32LittleEndian (bytes) != RecencyMagic)
+				return;
+			var count = BinaryPrimitives.ReadInt32LittleEndian (bytes.AsSpan (4));
+			if (count < 0 || bytes.Length != RecencyHeaderSize + (long)RecencyKeySize * count)
+				return;
+
+			var ranks = new Dictionary<SKPictureCacheKey, int> (count);
+			for (var i = 0; i < count; i++) {
+				var position = RecencyHeaderSize + RecencyKeySize * i;
+				var key = new SKPictureCacheKey (
+					BinaryPrimitives.ReadUInt64LittleEndian (bytes.AsSpan (position)),
+					BinaryPrimitives.ReadUInt64LittleEndian (bytes.AsSpan (position + 8)));
+				if (!ranks.ContainsKey (key))
+					ranks[key] = i;
+			}
+
+			var added = new List<Entry> ();
+			var saved = new List<Entry> ();
+			foreach (var entry in recentlyUsed)
+				(ranks.ContainsKey (entry.Key) ? saved : added).Add (entry);
+			saved.Sort ((a, b) => ranks[a.Key].CompareTo (ranks[b.Key]));
+
+			recentlyUsed.Clear ();
+			foreach (var entry in added)
+				entries[entry.Key] = entry.Node = recentlyUsed.AddLast (entry);
+			foreach (var entry in saved)
+				entries[entry.Key] = entry.Node = recentlyUsed.AddLast (entry);
+		}
+
+		private static bool ReadFully (Stream stream, byte[] buffer, int count)
+		{
+			var total = 0;
+			int read;
+			while (total < count && (read = stream.Read (buffer, total, count - total)) > 0)
+				total += read;
+			return total == count;
+		}
+
+		private sealed class Segment
+		{
+			public Segment (int id, string path)
+			{
+				Id = id;
+				Path = path;
+			}
+
+			public int Id { get; }
+
+			public string Path { get; }
+
+			// the size of the file, including the removed pictures
+			public long Length { get; set; }
+
+			public int LiveCount { get; set; }
+
+			public SKData Mapping { get; set; }
+
+			// the keys of all the records, including the ones that are dead
+			public HashSet<SKPictureCacheKey> Keys { get; } = new HashSet<SKPictureCacheKey> ();
+
+			public HashSet<SKPictureCacheKey> Tombstones { get; } = new HashSet<SKPictureCacheKey> ();
+		}
+
+		private sealed class Entry
+		{
+			public Entry (SKPictureCacheKey key, Segment segment, long offset, int length)
+			{
+				Key = key;
+				Segment = segment;
+				Offset = offset;
+				Length = length;
+			}
+
+			public SKPictureCacheKey Key { get; }
+
+			public Segment Segment { get; }
+
+			// the position of the serialized picture in the segment
+			public long Offset { get; }
+
+			public int Length { get; }
+
+			public LinkedListNode<Entry> Node { get; set; }
+		}
+	}
+
+	// A 128-bit hash of the content that a picture was recorded from, so
+	// that the same content finds the same picture in every process.
+	public readonly struct SKPictureCacheKey : IEquatable<SKPictureCacheKey>
+	{
+		public SKPictureCacheKey (ulong high, ulong low)
+		{
+			High = high;
+			Low = low;
+		}
+
+		public ulong High { get; }
+
+		public ulong Low { get; }
+
+		public static SKPictureCacheKey FromContent (byte[] content)
+		{
+			if (content == null)
+				throw new ArgumentNullException (nameof (content));
+
+			return FromContent (content.AsSpan ());
+		}
+
+		public static SKPictureCacheKey FromContent (ReadOnlySpan<byte> content)
+		{
+			MurmurHash3 (content, out var high, out var low);
+			return new SKPictureCacheKey (high, low);
+		}
+
+		public static SKPictureCacheKey FromString (string value)
+		{
+			if (value == null)
+				throw new ArgumentNullException (nameof (value));
+
+			return FromContent (Encoding.UTF8.GetBytes (value));
+		}
+
+		public bool Equals (SKPictureCacheKey obj) =>
+			High == obj.High && Low == obj.Low;
+
+		public override bool Equals (object obj) =>
+			obj is SKPictureCacheKey f && Equals (f);
+
+		public static bool operator == (SKPictureCacheKey left, SKPictureCacheKey right) =>
+			left.Equals (right);
+
+		public static bool operator != (SKPictureCacheKey left, SKPictureCacheKey right) =>
+			!left.Equals (right);
+
+		public override int GetHashCode () =>
+			(int)Low ^ (int)(Low >> 32);
+
+		public override string ToString () =>
+			High.ToString ("x16") + Low.ToString ("x16");
+
+		// MurmurHash3 x64 128-bit with a zero seed
+		private static void MurmurHash3 (ReadOnlySpan<byte> data, out ulong h1, out ulong h2)
+		{
+			const ulong c1 = 0x87c37b91114253d5;
+			const ulong c2 = 0x4cf5ad432745937f;
+
+			h1 = 0;
+			h2 = 0;
+
+			var blocks = data.Length / 16;
+			for (var i = 0; i < blocks; i++) {
+				var k1 = BinaryPrimitives.ReadUInt64LittleEndian (data.Slice (i * 16));
+				var k2 = BinaryPrimitives.ReadUInt64LittleEndian (data.Slice (i * 16 + 8));
+
+				h1 ^= MixKey1 (k1);
+				h1 = RotateLeft (h1, 27) + h2;
+				h1 = h1 * 5 + 0x52dce729;
+
+				h2 ^= MixKey2 (k2);
+				h2 = RotateLeft (h2, 31) + h1;
+				h2 = h2 * 5 + 0x38495ab5;
+			}
+
+			var tail = data.Slice (blocks * 16);
+			if (tail.Length > 8) {
+				var k2 = 0UL;
+				for (var i = tail.Length - 1; i >= 8; i--)
+					k2 = (k2 << 8) | tail[i];
+				h2 ^= MixKey2 (k2);
+			}
+			if (tail.Length > 0) {
+				var k1 = 0UL;
+				for (var i = Math.Min (tail.Length, 8) - 1; i >= 0; i--)
+					k1 = (k1 << 8) | tail[i];
+				h1 ^= MixKey1 (k1);
+			}
+
+			h1 ^= (ulong)data.Length;
+			h2 ^= (ulong)data.Length;
+			h1 += h2;
+			h2 += h1;
+			h1 = Finalize (h1);
+			h2 = Finalize (h2);
+			h1 += h2;
+			h2 += h1;
+
+			static ulong MixKey1 (ulong k) => RotateLeft (k * c1, 31) * c2;
+
+			static ulong MixKey2 (ulong k) => RotateLeft (k * c2, 33) * c1;
+
+			static ulong RotateLeft (ulong x, int r) => (x << r) | (x >> (64 - r));
+
+			static ulong Finalize (ulong k)
+			{
+				k ^= k >> 33;
+				k *= 0xff51afd7ed558ccd;
+				k ^= k >> 33;
+				k *= 0xc4ceb9fe1a85ec53;
+				k ^= k >> 33;
+				return k;
+			}
+		}
+	}
+}
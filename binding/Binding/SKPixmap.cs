@@ -221,7 +221,7 @@ namespace SkiaSharp
 			if (dst == null)
 				throw new ArgumentNullException (nameof (dst));
 
-			using var wrapped = new SKManagedWStream (dst);
+			using var wrapped = new SKManagedWStream (dst, false, SKManagedWStream.DefaultBufferSize);
 			return Encode (wrapped, encoder, quality);
 		}
 
@@ -271,7 +271,7 @@ namespace SkiaSharp
 			if (dst == null)
 				throw new ArgumentNullException (nameof (dst));
 
-			using var wrapped = new SKManagedWStream (dst);
+			using var wrapped = new SKManagedWStream (dst, false, SKManagedWStream.DefaultBufferSize);
 			return Encode (wrapped, options);
 		}
 
@@ -309,7 +309,7 @@ namespace SkiaSharp
 			if (dst == null)
 				throw new ArgumentNullException (nameof (dst));
 
-			using var wrapped = new SKManagedWStream (dst);
+			using var wrapped = new SKManagedWStream (dst, false, SKManagedWStream.DefaultBufferSize);
 			return Encode (wrapped, options);
 		}
 
@@ -347,7 +347,7 @@ namespace SkiaSharp
 			if (dst == null)
 				throw new ArgumentNullException (nameof (dst));
 
-			using var wrapped = new SKManagedWStream (dst);
+			using var wrapped = new SKManagedWStream (dst, false, SKManagedWStream.DefaultBufferSize);
 			return Encode (wrapped, options);
 		}
 
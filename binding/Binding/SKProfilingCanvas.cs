@@ -0,0 +1,531 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Text;
+
+namespace SkiaSharp
+{
+	public enum SKCanvasOperation
+	{
+		Discard = 0,
+		Save = 1,
+		SaveLayer = 2,
+		Restore = 3,
+		RestoreToCount = 4,
+		Translate = 5,
+		Scale = 6,
+		Rotate = 7,
+		Skew = 8,
+		Concat = 9,
+		SetMatrix = 10,
+		ResetMatrix = 11,
+		ClipRect = 12,
+		ClipRoundRect = 13,
+		ClipPath = 14,
+		ClipRegion = 15,
+		Clear = 16,
+		DrawColor = 17,
+		DrawPaint = 18,
+		DrawLine = 19,
+		DrawRegion = 20,
+		DrawRect = 21,
+		DrawRoundRect = 22,
+		DrawRoundRectDifference = 23,
+		DrawOval = 24,
+		DrawCircle = 25,
+		DrawArc = 26,
+		DrawPath = 27,
+		DrawPoints = 28,
+		DrawPoint = 29,
+		DrawImage = 30,
+		DrawImageNinePatch = 31,
+		DrawImageLattice = 32,
+		DrawBitmap = 33,
+		DrawSurface = 34,
+		DrawPicture = 35,
+		DrawDrawable = 36,
+		DrawTextBlob = 37,
+		DrawText = 38,
+		DrawTextOnPath = 39,
+		DrawVertices = 40,
+		DrawAtlas = 41,
+		DrawPatch = 42,
+		DrawAnnotation = 43,
+		Flush = 44,
+	}
+
+	[Flags]
+	public enum SKPaintFeatures
+	{
+		None = 0,
+		Antialias = 1 << 0,
+		Stroke = 1 << 1,
+		Shader = 1 << 2,
+		ColorFilter = 1 << 3,
+		MaskFilter = 1 << 4,
+		ImageFilter = 1 << 5,
+		PathEffect = 1 << 6,
+		BlendMode = 1 << 7,
+		SaveLayer = 1 << 8,
+	}
+
+	// Wraps a canvas and records the count and time of each canvas operation.
+	//
+	// Only the outermost call is recorded, so DrawText(string) includes the
+	// time to create the text blob. Every operation is counted, but only every
+	// SampleInterval-th operation is timed and has its paint inspected, which
+	// keeps the overhead low enough to use on production frames.
+	public sealed class SKProfilingCanvas : SKCanvas, ISKSkipObjectRegistration
+	{
+		private const int DefaultMaxTraceEvents = 100000;
+
+		private static readonly int OperationCount = Enum.GetValues (typeof (SKCanvasOperation)).Length;
+		private static readonly SKPaintFeatures[] AllFeatures = Enum.GetValues (typeof (SKPaintFeatures))
+			.Cast<SKPaintFeatures> ()
+			.Where (f => f != SKPaintFeatures.None)
+			.ToArray ();
+
+		private readonly SKCanvas canvas;
+
+		private readonly long[] counts = new long[OperationCount];
+		private readonly long[] sampledCounts = new long[OperationCount];
+		private readonly long[] sampledTicks = new long[OperationCount];
+		private readonly long[,] featureCounts = new long[OperationCount, AllFeatures.Length];
+		private readonly Dictionary<CallerKey, CallerStats> callers = new Dictionary<CallerKey, CallerStats> ();
+		private readonly List<TraceEvent> traceEvents = new List<TraceEvent> ();
+
+		private int sampleInterval = 1;
+		private int sampleCounter;
+		private int depth;
+		private long overheadTicks;
+		private long startTimestamp;
+
+		public SKProfilingCanvas (SKCanvas canvas)
+			: base (canvas?.Handle ?? IntPtr.Zero, false)
+		{
+			this.canvas = canvas ?? throw new ArgumentNullException (nameof (canvas));
+			startTimestamp = Stopwatch.GetTimestamp ();
+		}
+
+		protected override void Dispose (bool disposing) =>
+			base.Dispose (disposing);
+
+		public SKCanvas Canvas => canvas;
+
+		// time every n-th operation, 1 will time every operation
+		public int SampleInterval {
+			get => sampleInterval;
+			set {
+				if (value < 1)
+					throw new ArgumentOutOfRangeException (nameof (value));
+				sampleInterval = value;
+			}
+		}
+
+		// attribute sampled operations to the first calling method outside of SkiaSharp
+		public bool CaptureCallers { get; set; }
+
+		// keep each sampled operation for WriteChromeTrace
+		public bool RecordTrace { get; set; }
+
+		public int MaxTraceEvents { get; set; } = DefaultMaxTraceEvents;
+
+		// the time spent inspecting paints and recording the results
+		public TimeSpan OverheadTime => ToTimeSpan (overheadTicks);
+
+		public void Reset ()
+		{
+			Array.Clear (counts, 0, counts.Length);
+			Array.Clear (sampledCounts, 0, sampledCounts.Length);
+			Array.Clear (sampledTicks, 0, sampledTicks.Length);
+			Array.Clear (featureCounts, 0, featureCounts.Length);
+			callers.Clear ();
+			traceEvents.Clear ();
+			sampleCounter = 0;
+			overheadTicks = 0;
+			startTimestamp = Stopwatch.GetTimestamp ();
+		}
+
+		public SKProfilingReport GetReport ()
+		{
+			var operations = new List<SKCanvasOperationStats> ();
+			for (var op = 0; op < OperationCount; op++) {
+				if (counts[op] == 0)
+					continue;
+
+				var features = new Dictionary<SKPaintFeatures, long> ();
+				for (var f = 0; f < AllFeatures.Length; f++) {
+					if (featureCounts[op, f] > 0)
+						features[AllFeatures[f]] = featureCounts[op, f];
+				}
+
+				operations.Add (new SKCanvasOperationStats (
+					(SKCanvasOperation)op, counts[op], sampledCounts[op], ToTimeSpan (sampledTicks[op]), features));
+			}
+
+			var callerStats = callers
+				.Select (c => new SKCanvasCallerStats (c.Key.Operation, c.Key.Caller, c.Value.Count, ToTimeSpan (c.Value.Ticks)))
+				.OrderByDescending (c => c.Time)
+				.ToList ();
+
+			return new SKProfilingReport (
+				operations.OrderByDescending (o => o.EstimatedTime).ToList (),
+				callerStats,
+				OverheadTime);
+		}
+
+		// writes the recorded operations in the Chrome trace event format,
+		// which can be opened in chrome://tracing, Perfetto or speedscope
+		public void WriteChromeTrace (Stream stream)
+		{
+			if (stream == null)
+				throw new ArgumentNullException (nameof (stream));
+
+			using var writer = new StreamWriter (stream, new UTF8Encoding (false), 4096, true);
+			WriteChromeTrace (writer);
+		}
+
+		public void WriteChromeTrace (TextWriter writer)
+		{
+			if (writer == null)
+				throw new ArgumentNullException (nameof (writer));
+
+			writer.Write ("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+			for (var i = 0; i < traceEvents.Count; i++) {
+				var e = traceEvents[i];
+				if (i > 0)
+					writer.Write (',');
+
+				writer.Write ("{\"name\":\"");
+				writer.Write (e.Operation.ToString ());
+				writer.Write ("\",\"cat\":\"SkiaSharp\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+				writer.Write (e.ThreadId.ToString (CultureInfo.InvariantCulture));
+				writer.Write (",\"ts\":");
+				writer.Write (ToMicroseconds (e.Start - startTimestamp).ToString ("0.###", CultureInfo.InvariantCulture));
+				writer.Write (",\"dur\":");
+				writer.Write (ToMicroseconds (e.Duration).ToString ("0.###", CultureInfo.InvariantCulture));
+				writer.Write (",\"args\":{\"features\":\"");
+				writer.Write (e.Features.ToString ());
+				writer.Write ('"');
+				if (e.Caller != null) {
+					writer.Write (",\"caller\":\"");
+					WriteJsonEscaped (writer, e.Caller);
+					writer.Write ('"');
+				}
+				writer.Write ("}}");
+			}
+			writer.Write ("]}");
+		}
+
+		internal SKCanvasProfilingScope BeginOperation (SKCanvasOperation operation, SKPaint paint)
+		{
+			if (depth++ > 0)
+				return new SKCanvasProfilingScope (this, operation, null, 0);
+
+			counts[(int)operation]++;
+
+			if (sampleInterval > 1 && ++sampleCounter < sampleInterval)
+				return new SKCanvasProfilingScope (this, operation, null, 0);
+
+			sampleCounter = 0;
+			return new SKCanvasProfilingScope (this, operation, paint, Stopwatch.GetTimestamp ());
+		}
+
+		internal void EndOperation (SKCanvasOperation operation, SKPaint paint, long start)
+		{
+			var end = Stopwatch.GetTimestamp ();
+
+			depth--;
+			if (start == 0)
+				return;
+
+			var op = (int)operation;
+			var ticks = end - start;
+			sampledCounts[op]++;
+			sampledTicks[op] += ticks;
+
+			var features = GetFeatures (operation, paint);
+			if (features != SKPaintFeatures.None) {
+				for (var f = 0; f < AllFeatures.Length; f++) {
+					if ((features & AllFeatures[f]) != 0)
+						featureCounts[op, f]++;
+				}
+			}
+
+			string caller = null;
+			if (CaptureCallers) {
+				caller = GetCaller ();
+				var key = new CallerKey (operation, caller);
+				callers.TryGetValue (key, out var stats);
+				callers[key] = new CallerStats (stats.Count + 1, stats.Ticks + ticks);
+			}
+
+			if (RecordTrace && traceEvents.Count < MaxTraceEvents)
+				traceEvents.Add (new TraceEvent (operation, start, ticks, features, Environment.CurrentManagedThreadId, caller));
+
+			overheadTicks += Stopwatch.GetTimestamp () - end;
+		}
+
+		private static SKPaintFeatures GetFeatures (SKCanvasOperation operation, SKPaint paint)
+		{
+			var features = operation == SKCanvasOperation.SaveLayer
+				? SKPaintFeatures.SaveLayer
+				: SKPaintFeatures.None;
+
+			if (paint == null || paint.Handle == IntPtr.Zero)
+				return features;
+
+			var handle = paint.Handle;
+			if (SkiaApi.sk_paint_is_antialias (handle))
+				features |= SKPaintFeatures.Antialias;
+			if (SkiaApi.sk_paint_get_style (handle) != SKPaintStyle.Fill)
+				features |= SKPaintFeatures.Stroke;
+			if (SkiaApi.sk_paint_get_blendmode (handle) != SKBlendMode.SrcOver)
+				features |= SKPaintFeatures.BlendMode;
+
+			// the getters return a new reference, so avoid creating managed wrappers
+			if (ReleaseEffect (SkiaApi.sk_paint_get_shader (handle)))
+				features |= SKPaintFeatures.Shader;
+			if (ReleaseEffect (SkiaApi.sk_paint_get_colorfilter (handle)))
+				features |= SKPaintFeatures.ColorFilter;
+			if (ReleaseEffect (SkiaApi.sk_paint_get_maskfilter (handle)))
+				features |= SKPaintFeatures.MaskFilter;
+			if (ReleaseEffect (SkiaApi.sk_paint_get_imagefilter (handle)))
+				features |= SKPaintFeatures.ImageFilter;
+			if (ReleaseEffect (SkiaApi.sk_paint_get_path_effect (handle)))
+				features |= SKPaintFeatures.PathEffect;
+
+			return features;
+
+			static bool ReleaseEffect (IntPtr effect)
+			{
+				if (effect == IntPtr.Zero)
+					return false;
+				SkiaApi.sk_refcnt_safe_unref (effect);
+				return true;
+			}
+		}
+
+		private static string GetCaller ()
+		{
+#if NETSTANDARD1_3
+			return null;
+#else
+			var skiaAssembly = typeof (SKCanvas).Assembly;
+			var trace = new StackTrace (2, false);
+			for (var i = 0; i < trace.FrameCount; i++) {
+				var method = trace.GetFrame (i)?.GetMethod ();
+				var type = method?.DeclaringType;
+				if (type == null || type.Assembly == skiaAssembly)
+					continue;
+				return type.FullName + "." + method.Name;
+			}
+			return null;
+#endif
+		}
+
+		private static void WriteJsonEscaped (TextWriter writer, string value)
+		{
+			foreach (var c in value) {
+				if (c == '"' || c == '\\') {
+					writer.Write ('\\');
+					writer.Write (c);
+				} else if (c < ' ') {
+					writer.Write ("\\u");
+					writer.Write (((int)c).ToString ("x4", CultureInfo.InvariantCulture));
+				} else {
+					writer.Write (c);
+				}
+			}
+		}
+
+		private static TimeSpan ToTimeSpan (long ticks) =>
+			TimeSpan.FromTicks ((long)(ticks * ((double)TimeSpan.TicksPerSecond / Stopwatch.Frequency)));
+
+		private static double ToMicroseconds (long ticks) =>
+			ticks * 1_000_000.0 / Stopwatch.Frequency;
+
+		private readonly struct CallerKey : IEquatable<CallerKey>
+		{
+			public CallerKey (SKCanvasOperation operation, string caller)
+			{
+				Operation = operation;
+				Caller = caller ?? string.Empty;
+			}
+
+			public SKCanvasOperation Operation { get; }
+
+			public string Caller { get; }
+
+			public bool Equals (CallerKey other) =>
+				Operation == other.Operation && Caller == other.Caller;
+
+			public override bool Equals (object obj) =>
+				obj is CallerKey other && Equals (other);
+
+			public override int GetHashCode ()
+			{
+				var hash = new HashCode ();
+				hash.Add (Operation);
+				hash.Add (Caller);
+				return hash.ToHashCode ();
+			}
+		}
+
+		private readonly struct CallerStats
+		{
+			public CallerStats (long count, long ticks)
+			{
+				Count = count;
+				Ticks = ticks;
+			}
+
+			public long Count { get; }
+
+			public long Ticks { get; }
+		}
+
+		private readonly struct TraceEvent
+		{
+			public TraceEvent (SKCanvasOperation operation, long start, long duration, SKPaintFeatures features, int threadId, string caller)
+			{
+				Operation = operation;
+				Start = start;
+				Duration = duration;
+				Features = features;
+				ThreadId = threadId;
+				Caller = caller;
+			}
+
+			public SKCanvasOperation Operation { get; }
+
+			public long Start { get; }
+
+			public long Duration { get; }
+
+			public SKPaintFeatures Features { get; }
+
+			public int ThreadId { get; }
+
+			public string Caller { get; }
+		}
+	}
+
+	internal readonly struct SKCanvasProfilingScope : IDisposable
+	{
+		private readonly SKProfilingCanvas profiler;
+		private readonly SKCanvasOperation operation;
+		private readonly SKPaint paint;
+		private readonly long start;
+
+		public SKCanvasProfilingScope (SKProfilingCanvas profiler, SKCanvasOperation operation, SKPaint paint, long start)
+		{
+			this.profiler = profiler;
+			this.operation = operation;
+			this.paint = paint;
+			this.start = start;
+		}
+
+		public void Dispose () =>
+			profiler?.EndOperation (operation, paint, start);
+	}
+
+	public class SKCanvasOperationStats
+	{
+		internal SKCanvasOperationStats (SKCanvasOperation operation, long count, long sampledCount, TimeSpan sampledTime, IReadOnlyDictionary<SKPaintFeatures, long> featureCounts)
+		{
+			Operation = operation;
+			Count = count;
+			SampledCount = sampledCount;
+			SampledTime = sampledTime;
+			FeatureCounts = featureCounts;
+		}
+
+		public SKCanvasOperation Operation { get; }
+
+		// the number of times the operation was called
+		public long Count { get; }
+
+		// the number of calls that were timed
+		public long SampledCount { get; }
+
+		// the total time of the calls that were timed
+		public TimeSpan SampledTime { get; }
+
+		// the number of timed calls that used each paint feature
+		public IReadOnlyDictionary<SKPaintFeatures, long> FeatureCounts { get; }
+
+		public TimeSpan AverageTime =>
+			SampledCount == 0 ? TimeSpan.Zero : TimeSpan.FromTicks (SampledTime.Ticks / SampledCount);
+
+		// the sampled time scaled up to all the calls
+		public TimeSpan EstimatedTime =>
+			SampledCount == 0 ? TimeSpan.Zero : TimeSpan.FromTicks ((long)((double)SampledTime.Ticks * Count / SampledCount));
+
+		public override string ToString () =>
+			$"{Operation}: {Count} calls, {EstimatedTime.TotalMilliseconds:0.###} ms";
+	}
+
+	public class SKCanvasCallerStats
+	{
+		internal SKCanvasCallerStats (SKCanvasOperation operation, string caller, long sampledCount, TimeSpan time)
+		{
+			Operation = operation;
+			Caller = caller;
+			SampledCount = sampledCount;
+			Time = time;
+		}
+
+		public SKCanvasOperation Operation { get; }
+
+		public string Caller { get; }
+
+		public long SampledCount { get; }
+
+		public TimeSpan Time { get; }
+
+		public override string ToString () =>
+			$"{Caller} {Operation}: {SampledCount} calls, {Time.TotalMilliseconds:0.###} ms";
+	}
+
+	public class SKProfilingReport
+	{
+		internal SKProfilingReport (IReadOnlyList<SKCanvasOperationStats> operations, IReadOnlyList<SKCanvasCallerStats> callers, TimeSpan overheadTime)
+		{
+			Operations = operations;
+			Callers = callers;
+			OverheadTime = overheadTime;
+		}
+
+		// sorted by the estimated time, most expensive first
+		public IReadOnlyList<SKCanvasOperationStats> Operations { get; }
+
+		// empty unless SKProfilingCanvas.CaptureCallers was enabled
+		public IReadOnlyList<SKCanvasCallerStats> Callers { get; }
+
+		public TimeSpan OverheadTime { get; }
+
+		public long TotalCount => Operations.Sum (o => o.Count);
+
+		public TimeSpan EstimatedTotalTime => TimeSpan.FromTicks (Operations.Sum (o => o.EstimatedTime.Ticks));
+
+		public override string ToString ()
+		{
+			var sb = new StringBuilder ();
+			sb.AppendLine ($"{"Operation",-24} {"Count",10} {"Sampled",10} {"Time (ms)",12} {"Avg (us)",10}  Features");
+			foreach (var op in Operations) {
+				var features = string.Join (", ", op.FeatureCounts.Select (f => $"{f.Key}={f.Value}"));
+				sb.AppendLine (string.Format (CultureInfo.InvariantCulture,
+					"{0,-24} {1,10} {2,10} {3,12:0.###} {4,10:0.##}  {5}",
+					op.Operation, op.Count, op.SampledCount, op.EstimatedTime.TotalMilliseconds, op.AverageTime.Ticks / 10.0, features));
+			}
+			sb.AppendLine (string.Format (CultureInfo.InvariantCulture,
+				"Total: {0} calls, {1:0.###} ms, profiler overhead {2:0.###} ms",
+				TotalCount, EstimatedTotalTime.TotalMilliseconds, OverheadTime.TotalMilliseconds));
+			return sb.ToString ();
+		}
+	}
+}
@@ -0,0 +1,393 @@
+﻿using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace SkiaSharp
+{
+	// Decodes an image while the encoded bytes are still arriving. The bytes
+	// are read with ReadAsync into pooled chunks, and after each read the codec
+	// decodes as many rows as it can into the bitmap, so a view can draw the
+	// top of the image long before the rest has been downloaded. The formats
+	// that cannot be decoded incrementally are decoded once all the bytes are
+	// there.
+	//
+	// The decoder owns the bitmap until it is detached. The bitmap may be
+	// drawn while the decode is running, but the rows outside of the decoded
+	// bounds are transparent and the rows inside may still be changing.
+	public class SKProgressiveDecoder : IDisposable
+	{
+		private const int ChunkSize = 64 * 1024;
+
+		// the formats whose codecs only read what they need when they are
+		// created, the others (such as WebP, ICO and HEIF) copy the whole
+		// stream and so must wait for all of it
+		private static readonly byte[][] streamingSignatures = {
+			new byte[] { 0x89, (byte)'P', (byte)'N', (byte)'G', 0x0D, 0x0A, 0x1A, 0x0A },
+			new byte[] { (byte)'G', (byte)'I', (byte)'F', (byte)'8' },
+			new byte[] { 0xFF, 0xD8, 0xFF },
+			new byte[] { (byte)'B', (byte)'M' },
+		};
+
+		private readonly object locker = new object ();
+		private readonly ChunkBuffer buffer = new ChunkBuffer ();
+
+		private Stream stream;
+		private bool disposeStream;
+
+		private SKCodec codec;
+		private SKBitmap bitmap;
+		private int decodedRows;
+
+		private bool isStarted;
+		private bool isDecoding;
+		private bool isDisposed;
+
+		public SKProgressiveDecoder (Stream stream)
+			: this (stream, false)
+		{
+		}
+
+		public SKProgressiveDecoder (Stream stream, bool disposeStream)
+		{
+			this.stream = stream ?? throw new ArgumentNullException (nameof (stream));
+			this.disposeStream = disposeStream;
+		}
+
+		// the bitmap that is being decoded into, which is null until enough
+		// of the header has arrived
+		public SKBitmap Bitmap => Volatile.Read (ref bitmap);
+
+		public SKImageInfo Info => Bitmap?.Info ?? SKImageInfo.Empty;
+
+		public SKCodecScanlineOrder ScanlineOrder { get; private set; }
+
+		// false if the format can only be decoded once all the bytes are there
+		public bool IsIncremental { get; private set; }
+
+		public long ReceivedBytes => buffer.Length;
+
+		public int DecodedRows => Volatile.Read (ref decodedRows);
+
+		// the rows of the bitmap that have been decoded so far
+		public SKRectI DecodedBounds {
+			get {
+				var info = Info;
+				var rows = Math.Min (DecodedRows, info.Height);
+				return ScanlineOrder == SKCodecScanlineOrder.BottomUp
+					? new SKRectI (0, info.Height - rows, info.Width, info.Height)
+					: new SKRectI (0, 0, info.Width, rows);
+			}
+		}
+
+		public Task<SKCodecResult> DecodeAsync () =>
+			DecodeAsync (null, CancellationToken.None);
+
+		public Task<SKCodecResult> DecodeAsync (CancellationToken cancellationToken) =>
+			DecodeAsync (null, cancellationToken);
+
+		public Task<SKCodecResult> DecodeAsync (IProgress<SKRectI> progress) =>
+			DecodeAsync (progress, CancellationToken.None);
+
+		// the progress is given the decoded bounds every time that more rows
+		// have been decoded, and the result is IncompleteInput if the stream
+		// ended before the image did
+		public Task<SKCodecResult> DecodeAsync (IProgress<SKRectI> progress, CancellationToken cancellationToken)
+		{
+			lock (locker) {
+				if (isDisposed)
+					throw new ObjectDisposedException (nameof (SKProgressiveDecoder));
+				if (isStarted)
+					throw new InvalidOperationException ("The decoder can only be started once.");
+
+				isStarted = true;
+				isDecoding = true;
+			}
+
+			return DecodeAsyncCore (progress, cancellationToken);
+		}
+
+		// takes the ownership of the bitmap away from the decoder
+		public SKBitmap DetachBitmap ()
+		{
+			lock (locker) {
+				if (isDecoding)
+					throw new InvalidOperationException ("The bitmap cannot be detached while the decoder is running.");
+
+				return Interlocked.Exchange (ref bitmap, null);
+			}
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (!disposing)
+				return;
+
+			lock (locker) {
+				if (isDisposed)
+					return;
+				isDisposed = true;
+
+				// a running decode cleans up when it sees this
+				if (isDecoding)
+					return;
+			}
+
+			Release ();
+		}
+
+		private async Task<SKCodecResult> DecodeAsyncCore (IProgress<SKRectI> progress, CancellationToken cancellationToken)
+		{
+			try {
+				var isAtEnd = false;
+				while (true) {
+					cancellationToken.ThrowIfCancellationRequested ();
+					if (Volatile.Read (ref isDisposed))
+						throw new ObjectDisposedException (nameof (SKProgressiveDecoder));
+
+					if (!isAtEnd)
+						isAtEnd = await buffer.ReadFromAsync (stream, cancellationToken).ConfigureAwait (false) == 0;
+
+					if (codec == null) {
+						// wait for enough of the header to arrive
+						if (!isAtEnd && buffer.Length < SKCodec.MinBufferedBytesNeeded)
+							continue;
+						if (!isAtEnd && !IsStreamingFormat ())
+							continue;
+
+						var result = Start ();
+						if (result == SKCodecResult.IncompleteInput && !isAtEnd)
+							continue;
+						if (result != SKCodecResult.Success)
+							return result;
+					}
+
+					if (IsIncremental) {
+						var result = codec.IncrementalDecode (out var rows);
+						if (result == SKCodecResult.Success)
+							rows = bitmap.Height;
+
+						if (rows > decodedRows) {
+							Volatile.Write (ref decodedRows, rows);
+							progress?.Report (DecodedBounds);
+						}
+
+						if (result != SKCodecResult.IncompleteInput || isAtEnd)
+							return result;
+					} else if (isAtEnd) {
+						var result = codec.GetPixels (bitmap.Info, bitmap.GetPixels ());
+						if (result == SKCodecResult.Success || result == SKCodecResult.IncompleteInput) {
+							Volatile.Write (ref decodedRows, bitmap.Height);
+							progress?.Report (DecodedBounds);
+						}
+						return result;
+					}
+				}
+			} finally {
+				bool release;
+				lock (locker) {
+					isDecoding = false;
+					release = isDisposed;
+				}
+
+				// the codec is only needed while decoding
+				codec?.Dispose ();
+				codec = null;
+
+				if (release)
+					Release ();
+			}
+		}
+
+		// creates the codec once the header is there, and prepares the bitmap
+		private SKCodecResult Start ()
+		{
+			var candidate = SKCodec.Create (new ChunkStream (buffer), out var result);
+			if (candidate == null)
+				return result == SKCodecResult.Success ? SKCodecResult.InternalError : result;
+
+			// the same info as SKBitmap.Decode
+			var info = candidate.Info;
+			if (info.AlphaType == SKAlphaType.Unpremul)
+				info.AlphaType = SKAlphaType.Premul;
+			info.ColorSpace = null;
+
+			var target = new SKBitmap ();
+			if (!target.TryAllocPixels (info)) {
+				target.Dispose ();
+				candidate.Dispose ();
+				return SKCodecResult.InternalError;
+			}
+
+			// the rows that have not arrived yet are not drawn
+			target.Erase (SKColors.Transparent);
+
+			result = candidate.StartIncrementalDecode (info, target.GetPixels (), target.RowBytes);
+			if (result != SKCodecResult.Success && result != SKCodecResult.Unimplemented) {
+				target.Dispose ();
+				candidate.Dispose ();
+				return result;
+			}
+
+			codec = candidate;
+			ScanlineOrder = candidate.ScanlineOrder;
+			IsIncremental = result == SKCodecResult.Success;
+			Volatile.Write (ref bitmap, target);
+			return SKCodecResult.Success;
+		}
+
+		private bool IsStreamingFormat ()
+		{
+			foreach (var signature in streamingSignatures) {
+				if (buffer.StartsWith (signature))
+					return true;
+			}
+			return false;
+		}
+
+		private void Release ()
+		{
+			Interlocked.Exchange (ref bitmap, null)?.Dispose ();
+			buffer.Dispose ();
+
+			if (disposeStream)
+				stream?.Dispose ();
+			stream = null;
+		}
+
+		// all the bytes that have been received so far, in pooled chunks that
+		// are never moved so that they can be read while more are added
+		private sealed class ChunkBuffer : IDisposable
+		{
+			private readonly List<byte[]> chunks = new List<byte[]> ();
+			private long length;
+
+			public long Length => Interlocked.Read (ref length);
+
+			public bool IsCompleted { get; private set; }
+
+			// returns the number of bytes that were read, or zero at the end
+			public async Task<int> ReadFromAsync (Stream stream, CancellationToken cancellationToken)
+			{
+				var used = (int)(length % ChunkSize);
+				if (used == 0 && chunks.Count * (long)ChunkSize == length)
+					chunks.Add (ArrayPool<byte>.Shared.Rent (ChunkSize));
+
+				var chunk = chunks[chunks.Count - 1];
+				var read = await stream.ReadAsync (chunk, used, ChunkSize - used, cancellationToken).ConfigureAwait (false);
+				if (read > 0)
+					Interlocked.Add (ref length, read);
+				else
+					IsCompleted = true;
+
+				return read;
+			}
+
+			public bool StartsWith (byte[] signature)
+			{
+				if (Length < signature.Length)
+					return false;
+
+				var first = chunks[0];
+				for (var i = 0; i < signature.Length; i++) {
+					if (first[i] != signature[i])
+						return false;
+				}
+				return true;
+			}
+
+			// copies the bytes at the position into the native memory, and
+			// returns the number that were available
+			public int CopyTo (long position, IntPtr destination, int count)
+			{
+				var available = (int)Math.Max (0, Math.Min (count, Length - position));
+				if (destination == IntPtr.Zero)
+					return available;
+
+				var copied = 0;
+				while (copied < available) {
+					var index = (int)((position + copied) / ChunkSize);
+					var offset = (int)((position + copied) % ChunkSize);
+					var size = Math.Min (available - copied, ChunkSize - offset);
+
+					Marshal.Copy (chunks[index], offset, destination + copied, size);
+					copied += size;
+				}
+				return copied;
+			}
+
+			public void Dispose ()
+			{
+				foreach (var chunk in chunks)
+					ArrayPool<byte>.Shared.Return (chunk);
+				chunks.Clear ();
+				Interlocked.Exchange (ref length, 0);
+			}
+		}
+
+		// a native stream over the received bytes, which does not report the
+		// end until the whole stream has been received
+		private sealed class ChunkStream : SKAbstractManagedStream
+		{
+			private readonly ChunkBuffer buffer;
+			private long position;
+
+			public ChunkStream (ChunkBuffer buffer)
+			{
+				this.buffer = buffer;
+			}
+
+			protected override IntPtr OnRead (IntPtr destination, IntPtr size)
+			{
+				var read = buffer.CopyTo (position, destination, (int)size);
+				position += read;
+				return (IntPtr)read;
+			}
+
+			protected override IntPtr OnPeek (IntPtr destination, IntPtr size) =>
+				(IntPtr)buffer.CopyTo (position, destination, (int)size);
+
+			protected override bool OnIsAtEnd () =>
+				buffer.IsCompleted && position >= buffer.Length;
+
+			protected override bool OnHasPosition () => true;
+
+			protected override bool OnHasLength () => buffer.IsCompleted;
+
+			protected override bool OnRewind ()
+			{
+				position = 0;
+				return true;
+			}
+
+			protected override IntPtr OnGetPosition () => (IntPtr)position;
+
+			protected override IntPtr OnGetLength () =>
+				buffer.IsCompleted ? (IntPtr)buffer.Length : IntPtr.Zero;
+
+			protected override bool OnSeek (IntPtr newPosition)
+			{
+				position = Math.Min ((long)newPosition, buffer.Length);
+				return true;
+			}
+
+			protected override bool OnMove (int offset)
+			{
+				position = Math.Max (0, Math.Min (position + offset, buffer.Length));
+				return true;
+			}
+
+			protected override IntPtr OnCreateNew () =>
+				new ChunkStream (buffer).Handle;
+		}
+	}
+}
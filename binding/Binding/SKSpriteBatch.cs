@@ -0,0 +1,341 @@
+﻿using System;
+using System.Buffers;
+using System.Collections.Generic;
+
+namespace SkiaSharp
+{
+	// Collects sprites from texture atlases and draws them with as few
+	// DrawAtlas calls as possible. Consecutive sprites that use the same atlas
+	// and blend mode are drawn together, and the buffers are kept between
+	// flushes so that a frame does not allocate once the batch has warmed up.
+	//
+	// The sprites are drawn with the canvas state at the time of the flush,
+	// so the matrix and clip must not change while sprites are pending.
+	public class SKSpriteBatch : IDisposable
+	{
+		private const int InitialCapacity = 64;
+
+		private readonly List<SpriteRun> runs = new List<SpriteRun> ();
+		private readonly Stack<SpriteRun> freeRuns = new Stack<SpriteRun> ();
+		private readonly Dictionary<RunKey, SpriteRun> runLookup = new Dictionary<RunKey, SpriteRun> ();
+
+		private bool preserveOrder = true;
+		private SKRect clipBounds;
+		private bool hasClipBounds;
+		private bool isDisposed;
+
+		public SKSpriteBatch (SKCanvas canvas)
+			: this (canvas, null)
+		{
+		}
+
+		public SKSpriteBatch (SKCanvas canvas, SKPaint paint)
+		{
+			Canvas = canvas ?? throw new ArgumentNullException (nameof (canvas));
+			Paint = paint;
+		}
+
+		public SKCanvas Canvas { get; }
+
+		// the paint for the DrawAtlas calls, used for the filter quality
+		public SKPaint Paint { get; }
+
+		// when false, sprites are grouped by atlas and blend mode across the
+		// whole batch, which needs fewer calls but may change the overlap
+		public bool PreserveOrder {
+			get => preserveOrder;
+			set {
+				if (preserveOrder == value)
+					return;
+
+				Flush ();
+				preserveOrder = value;
+			}
+		}
+
+		// skip the sprites that are completely outside of the canvas clip
+		public bool CullToClip { get; set; }
+
+		public int PendingSpriteCount { get; private set; }
+
+		public long SpriteCount { get; private set; }
+
+		public long CulledSpriteCount { get; private set; }
+
+		public long DrawCallCount { get; private set; }
+
+		public void ResetStatistics ()
+		{
+			SpriteCount = 0;
+			CulledSpriteCount = 0;
+			DrawCallCount = 0;
+		}
+
+		// Draw
+
+		public void Draw (SKImage atlas, SKRect sprite, float x, float y) =>
+			Draw (atlas, sprite, SKRotationScaleMatrix.CreateTranslation (x, y), SKColors.White, SKBlendMode.Modulate);
+
+		public void Draw (SKImage atlas, SKRect sprite, float x, float y, SKColor tint) =>
+			Draw (atlas, sprite, SKRotationScaleMatrix.CreateTranslation (x, y), tint, SKBlendMode.Modulate);
+
+		// the anchor is a point in the sprite that is placed at the position,
+		// and is also the point that the sprite is rotated and scaled around
+		public void Draw (SKImage atlas, SKRect sprite, SKPoint position, float degrees, float scale, SKPoint anchor, SKColor tint) =>
+			Draw (atlas, sprite, SKRotationScaleMatrix.CreateDegrees (scale, degrees, position.X, position.Y, anchor.X, anchor.Y), tint, SKBlendMode.Modulate);
+
+		public void Draw (SKImage atlas, SKRect sprite, SKRotationScaleMatrix transform) =>
+			Draw (atlas, sprite, transform, SKColors.White, SKBlendMode.Modulate);
+
+		// the blend mode combines the tint with the sprite, and is ignored for
+		// a batch where none of the sprites have a tint
+		public void Draw (SKImage atlas, SKRect sprite, SKRotationScaleMatrix transform, SKColor tint, SKBlendMode mode)
+		{
+			if (atlas == null)
+				throw new ArgumentNullException (nameof (atlas));
+			if (isDisposed)
+				throw new ObjectDisposedException (nameof (SKSpriteBatch));
+
+			SpriteCount++;
+
+			var bounds = SKRect.Empty;
+			if (CullToClip) {
+				if (!hasClipBounds) {
+					Canvas.GetLocalClipBounds (out clipBounds);
+					hasClipBounds = true;
+				}
+
+				bounds = GetBounds (sprite, transform);
+				if (!bounds.IntersectsWith (clipBounds)) {
+					CulledSpriteCount++;
+					return;
+				}
+			}
+
+			GetRun (atlas, mode).Add (sprite, transform, tint, bounds, CullToClip);
+			PendingSpriteCount++;
+		}
+
+		// Flush
+
+		public void Flush ()
+		{
+			if (isDisposed)
+				throw new ObjectDisposedException (nameof (SKSpriteBatch));
+
+			try {
+				foreach (var run in runs) {
+					var count = run.Count;
+					var sprites = new ReadOnlySpan<SKRect> (run.Sprites, 0, count);
+					var transforms = new ReadOnlySpan<SKRotationScaleMatrix> (run.Transforms, 0, count);
+					var colors = run.HasColors
+						? new ReadOnlySpan<SKColor> (run.Colors, 0, count)
+						: ReadOnlySpan<SKColor>.Empty;
+
+					if (run.HasBounds)
+						Canvas.DrawAtlas (run.Atlas, sprites, transforms, colors, run.Mode, run.Bounds, Paint);
+					else
+						Canvas.DrawAtlas (run.Atlas, sprites, transforms, colors, run.Mode, Paint);
+
+					DrawCallCount++;
+				}
+			} finally {
+				Clear ();
+			}
+		}
+
+		// discards all the pending sprites
+		public void Clear ()
+		{
+			foreach (var run in runs) {
+				run.Reset ();
+				freeRuns.Push (run);
+			}
+
+			runs.Clear ();
+			runLookup.Clear ();
+
+			PendingSpriteCount = 0;
+			hasClipBounds = false;
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		// any pending sprites are discarded, call Flush to draw them first
+		protected virtual void Dispose (bool disposing)
+		{
+			if (!disposing || isDisposed)
+				return;
+
+			Clear ();
+
+			while (freeRuns.Count > 0)
+				freeRuns.Pop ().Release ();
+
+			isDisposed = true;
+		}
+
+		private SpriteRun GetRun (SKImage atlas, SKBlendMode mode)
+		{
+			if (runs.Count > 0) {
+				var last = runs[runs.Count - 1];
+				if (last.Atlas == atlas && last.Mode == mode)
+					return last;
+			}
+
+			var key = new RunKey (atlas, mode);
+			if (!preserveOrder && runLookup.TryGetValue (key, out var existing))
+				return existing;
+
+			var run = freeRuns.Count > 0 ? freeRuns.Pop () : new SpriteRun ();
+			run.Atlas = atlas;
+			run.Mode = mode;
+			runs.Add (run);
+
+			if (!preserveOrder)
+				runLookup[key] = run;
+
+			return run;
+		}
+
+		internal static SKRect GetBounds (SKRect sprite, SKRotationScaleMatrix transform)
+		{
+			// the corners of the sprite after the RSXform is applied
+			var w = sprite.Width;
+			var h = sprite.Height;
+			var c = transform.SCos;
+			var s = transform.SSin;
+
+			var x1 = transform.TX + c * w;
+			var y1 = transform.TY + s * w;
+			var x2 = transform.TX - s * h;
+			var y2 = transform.TY + c * h;
+			var x3 = x1 - s * h;
+			var y3 = y1 + c * h;
+
+			return new SKRect (
+				Math.Min (Math.Min (transform.TX, x1), Math.Min (x2, x3)),
+				Math.Min (Math.Min (transform.TY, y1), Math.Min (y2, y3)),
+				Math.Max (Math.Max (transform.TX, x1), Math.Max (x2, x3)),
+				Math.Max (Math.Max (transform.TY, y1), Math.Max (y2, y3)));
+		}
+
+		private readonly struct RunKey : IEquatable<RunKey>
+		{
+			public RunKey (SKImage atlas, SKBlendMode mode)
+			{
+				Atlas = atlas;
+				Mode = mode;
+			}
+
+			public SKImage Atlas { get; }
+
+			public SKBlendMode Mode { get; }
+
+			public bool Equals (RunKey obj) =>
+				Atlas == obj.Atlas && Mode == obj.Mode;
+
+			public override bool Equals (object obj) =>
+				obj is RunKey k && Equals (k);
+
+			public override int GetHashCode ()
+			{
+				var hash = new HashCode ();
+				hash.Add (Atlas);
+				hash.Add (Mode);
+				return hash.ToHashCode ();
+			}
+		}
+
+		private sealed class SpriteRun
+		{
+			public SKImage Atlas;
+			public SKBlendMode Mode;
+			public int Count;
+
+			public SKRect[] Sprites = new SKRect[0];
+			public SKRotationScaleMatrix[] Transforms = new SKRotationScaleMatrix[0];
+			public SKColor[] Colors = new SKColor[0];
+
+			// the colors are only sent when at least one sprite has a tint
+			public bool HasColors;
+
+			public SKRect Bounds;
+			public bool HasBounds;
+
+			public void Add (SKRect sprite, SKRotationScaleMatrix transform, SKColor tint, SKRect bounds, bool hasBounds)
+			{
+				if (Count == Sprites.Length)
+					Grow ();
+
+				Sprites[Count] = sprite;
+				Transforms[Count] = transform;
+
+				if (tint != SKColors.White && !HasColors) {
+					// the earlier sprites did not have a tint
+					HasColors = true;
+					Colors.AsSpan (0, Count).Fill (SKColors.White);
+				}
+				if (HasColors)
+					Colors[Count] = tint;
+
+				// the run is only culled as a whole if every sprite has bounds
+				if (Count == 0) {
+					Bounds = bounds;
+					HasBounds = hasBounds;
+				} else if (HasBounds && hasBounds) {
+					Bounds = SKRect.Union (Bounds, bounds);
+				} else {
+					HasBounds = false;
+				}
+
+				Count++;
+			}
+
+			public void Reset ()
+			{
+				Atlas = null;
+				Count = 0;
+				HasColors = false;
+				HasBounds = false;
+			}
+
+			public void Release ()
+			{
+				Return (Sprites);
+				Return (Transforms);
+				Return (Colors);
+
+				Sprites = new SKRect[0];
+				Transforms = new SKRotationScaleMatrix[0];
+				Colors = new SKColor[0];
+			}
+
+			private void Grow ()
+			{
+				var capacity = Math.Max (InitialCapacity, Sprites.Length * 2);
+				Sprites = Resize (Sprites, capacity, Count);
+				Transforms = Resize (Transforms, capacity, Count);
+				Colors = Resize (Colors, capacity, HasColors ? Count : 0);
+			}
+
+			private static T[] Resize<T> (T[] array, int capacity, int count)
+			{
+				var resized = ArrayPool<T>.Shared.Rent (capacity);
+				Array.Copy (array, resized, count);
+				Return (array);
+				return resized;
+			}
+
+			private static void Return<T> (T[] array)
+			{
+				if (array.Length > 0)
+					ArrayPool<T>.Shared.Return (array);
+			}
+		}
+	}
+}
@@ -0,0 +1,122 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+
+namespace SkiaSharp
+{
+	public static class SKStartupTrace
+	{
+		private const string EnvironmentVariable = "SKIASHARP_STARTUP_TRACE";
+
+		private static readonly object locker = new object ();
+		private static readonly List<SKStartupTraceStep> steps = new List<SKStartupTraceStep> ();
+
+		static SKStartupTrace ()
+		{
+			var value = Environment.GetEnvironmentVariable (EnvironmentVariable);
+			IsEnabled = value == "1" || string.Equals (value, "true", StringComparison.OrdinalIgnoreCase);
+		}
+
+		// this must be set before the first SkiaSharp type is used in order
+		// to capture the native library load and the static instances
+		public static bool IsEnabled { get; set; }
+
+		public static IReadOnlyList<SKStartupTraceStep> GetSteps ()
+		{
+			lock (locker) {
+				return steps.ToArray ();
+			}
+		}
+
+		public static TimeSpan GetTotalElapsed ()
+		{
+			var total = TimeSpan.Zero;
+			lock (locker) {
+				foreach (var step in steps)
+					total += step.Elapsed;
+			}
+			return total;
+		}
+
+		public static void Clear ()
+		{
+			lock (locker) {
+				steps.Clear ();
+			}
+		}
+
+		internal static void Measure (string name, Action step)
+		{
+			if (!IsEnabled) {
+				step ();
+				return;
+			}
+
+			var start = Stopwatch.GetTimestamp ();
+			try {
+				step ();
+			} finally {
+				Record (name, start);
+			}
+		}
+
+		internal static T Measure<T> (string name, Func<T> step)
+		{
+			if (!IsEnabled)
+				return step ();
+
+			var start = Stopwatch.GetTimestamp ();
+			try {
+				return step ();
+			} finally {
+				Record (name, start);
+			}
+		}
+
+		private static void Record (string name, long start)
+		{
+			var ticks = Stopwatch.GetTimestamp () - start;
+			var elapsed = TimeSpan.FromTicks ((long)(ticks * ((double)TimeSpan.TicksPerSecond / Stopwatch.Frequency)));
+
+			lock (locker) {
+				steps.Add (new SKStartupTraceStep (name, elapsed));
+			}
+		}
+	}
+
+	public readonly struct SKStartupTraceStep : IEquatable<SKStartupTraceStep>
+	{
+		public SKStartupTraceStep (string name, TimeSpan elapsed)
+		{
+			Name = name;
+			Elapsed = elapsed;
+		}
+
+		public string Name { get; }
+
+		public TimeSpan Elapsed { get; }
+
+		public readonly bool Equals (SKStartupTraceStep obj) =>
+			Name == obj.Name && Elapsed == obj.Elapsed;
+
+		public readonly override bool Equals (object obj) =>
+			obj is SKStartupTraceStep f && Equals (f);
+
+		public static bool operator == (SKStartupTraceStep left, SKStartupTraceStep right) =>
+			left.Equals (right);
+
+		public static bool operator != (SKStartupTraceStep left, SKStartupTraceStep right) =>
+			!left.Equals (right);
+
+		public readonly override int GetHashCode ()
+		{
+			var hash = new HashCode ();
+			hash.Add (Name);
+			hash.Add (Elapsed);
+			return hash.ToHashCode ();
+		}
+
+		public readonly override string ToString () =>
+			$"{Name}: {Elapsed.TotalMilliseconds:0.###} ms";
+	}
+}
@@ -543,7 +543,7 @@ namespace SkiaSharp
 
 		public SKData DetachAsData ()
 		{
-			return SKData.GetObject (SkiaApi.sk_dynamicmemorywstream_detach_as_data (Handle));
+			return SKData.GetTrackedObject (SkiaApi.sk_dynamicmemorywstream_detach_as_data (Handle));
 		}
 
 		public void CopyTo (IntPtr data)
@@ -574,7 +574,7 @@ namespace SkiaSharp
 			if (dst == null)
 				throw new ArgumentNullException (nameof (dst));
 
-			using var wrapped = new SKManagedWStream (dst);
+			using var wrapped = new SKManagedWStream (dst, false, SKManagedWStream.DefaultBufferSize);
 			return CopyTo (wrapped);
 		}
 
@@ -18,13 +18,19 @@ namespace SkiaSharp
 		[Obsolete ("Use Create(SKImageInfo, IntPtr, int, SKSurfaceProperties) instead.")]
 		public static SKSurface Create (int width, int height, SKColorType colorType, SKAlphaType alphaType, IntPtr pixels, int rowBytes, SKSurfaceProps props) => Create (new SKImageInfo (width, height, colorType, alphaType), pixels, rowBytes, props);
 
+		// the size of the pixels that were allocated by the surface itself
+		private long nativeBytes;
+
 		internal SKSurface (IntPtr h, bool owns)
 			: base (h, owns)
 		{
 		}
 
-		protected override void Dispose (bool disposing) =>
+		protected override void Dispose (bool disposing)
+		{
 			base.Dispose (disposing);
+			SKNativeMemory.Release (ref nativeBytes);
+		}
 
 		// RASTER surface
 
@@ -45,9 +51,14 @@ namespace SkiaSharp
 		public static SKSurface Create (SKImageInfo info, int rowBytes, SKSurfaceProperties props)
 		{
 			var cinfo = SKImageInfoNative.FromManaged (ref info);
-			return GetObject (SkiaApi.sk_surface_new_raster (&cinfo, (IntPtr)rowBytes, props?.Handle ?? IntPtr.Zero));
+			var surface = GetObject (SkiaApi.sk_surface_new_raster (&cinfo, (IntPtr)rowBytes, props?.Handle ?? IntPtr.Zero));
+			surface?.TrackPixels (rowBytes > 0 ? (long)rowBytes * info.Height : info.BytesSize64);
+			return surface;
 		}
 
+		private void TrackPixels (long bytes) =>
+			SKNativeMemory.Track (ref nativeBytes, bytes);
+
 		// convenience RASTER DIRECT to use a SKPixmap instead of SKImageInfo and IntPtr
 
 		[EditorBrowsable (EditorBrowsableState.Never)]
@@ -396,8 +407,14 @@ namespace SkiaSharp
 
 		//
 
-		public SKCanvas Canvas =>
-			OwnedBy (SKCanvas.GetObject (SkiaApi.sk_surface_get_canvas (Handle), false, unrefExisting: false), this);
+		public SKCanvas Canvas {
+			get {
+				var canvas = OwnedBy (SKCanvas.GetObject (SkiaApi.sk_surface_get_canvas (Handle), false, unrefExisting: false), this);
+				if (canvas != null)
+					canvas.DrawsToPixels = true;
+				return canvas;
+			}
+		}
 
 		[EditorBrowsable (EditorBrowsableState.Never)]
 		[Obsolete ("Use SurfaceProperties instead.")]
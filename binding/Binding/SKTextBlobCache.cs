@@ -0,0 +1,223 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+
+namespace SkiaSharp
+{
+	// A bounded, least-recently-used cache of the text blobs that are created
+	// by the SKCanvas.DrawText (string, ...) overloads. The cache is opt-in
+	// by setting SKCanvas.TextBlobCache, and it may be shared by any number of
+	// canvases as long as they are only used from one thread at a time.
+	public class SKTextBlobCache : IDisposable
+	{
+		public const int DefaultCapacity = 1024;
+
+		private readonly Dictionary<TextBlobKey, LinkedListNode<TextBlobEntry>> entries;
+		private readonly LinkedList<TextBlobEntry> recentlyUsed = new LinkedList<TextBlobEntry> ();
+
+		private int capacity;
+
+		public SKTextBlobCache ()
+			: this (DefaultCapacity)
+		{
+		}
+
+		public SKTextBlobCache (int capacity)
+		{
+			if (capacity <= 0)
+				throw new ArgumentOutOfRangeException (nameof (capacity), "The capacity must be greater than zero.");
+
+			this.capacity = capacity;
+			entries = new Dictionary<TextBlobKey, LinkedListNode<TextBlobEntry>> (capacity);
+		}
+
+		public int Capacity {
+			get => capacity;
+			set {
+				if (value <= 0)
+					throw new ArgumentOutOfRangeException (nameof (value), "The capacity must be greater than zero.");
+
+				capacity = value;
+				Trim ();
+			}
+		}
+
+		public int Count => entries.Count;
+
+		public long HitCount { get; private set; }
+
+		public long MissCount { get; private set; }
+
+		public long EvictionCount { get; private set; }
+
+		public void ResetStatistics ()
+		{
+			HitCount = 0;
+			MissCount = 0;
+			EvictionCount = 0;
+		}
+
+		// removes all the cached blobs
+		public void Clear ()
+		{
+			foreach (var entry in recentlyUsed)
+				entry.Blob?.Dispose ();
+
+			recentlyUsed.Clear ();
+			entries.Clear ();
+		}
+
+		// removes all the cached blobs for the text, for any font
+		public int Remove (string text)
+		{
+			if (text == null)
+				throw new ArgumentNullException (nameof (text));
+
+			var removed = 0;
+			var node = recentlyUsed.First;
+			while (node != null) {
+				var next = node.Next;
+				if (node.Value.Key.Text == text) {
+					RemoveNode (node);
+					removed++;
+				}
+				node = next;
+			}
+			return removed;
+		}
+
+		// removes all the cached blobs that use the typeface
+		public int Remove (SKTypeface typeface)
+		{
+			var handle = typeface?.Handle ?? IntPtr.Zero;
+
+			var removed = 0;
+			var node = recentlyUsed.First;
+			while (node != null) {
+				var next = node.Next;
+				if (node.Value.Typeface == handle) {
+					RemoveNode (node);
+					removed++;
+				}
+				node = next;
+			}
+			return removed;
+		}
+
+		public void Dispose ()
+		{
+			Dispose (true);
+			GC.SuppressFinalize (this);
+		}
+
+		protected virtual void Dispose (bool disposing)
+		{
+			if (disposing)
+				Clear ();
+		}
+
+		// the returned blob is owned by the cache and must not be disposed,
+		// and the blob may be null if the text has no glyphs
+		internal SKTextBlob GetTextBlob (string text, SKFont font, bool measure, out float width)
+		{
+			var key = new TextBlobKey (text, font);
+
+			if (entries.TryGetValue (key, out var node)) {
+				HitCount++;
+
+				if (node != recentlyUsed.First) {
+					recentlyUsed.Remove (node);
+					recentlyUsed.AddFirst (node);
+				}
+			} else {
+				MissCount++;
+
+				// the typeface is only read back from the native font here
+				var typeface = SkiaApi.sk_font_get_typeface (font.Handle);
+				SkiaApi.sk_refcnt_safe_unref (typeface);
+
+				node = recentlyUsed.AddFirst (new TextBlobEntry (key, typeface, SKTextBlob.Create (text, font)));
+				entries.Add (key, node);
+				Trim ();
+			}
+
+			var entry = node.Value;
+			if (measure && entry.Width == null)
+				entry.Width = font.MeasureText (text);
+
+			width = entry.Width ?? 0;
+			return entry.Blob;
+		}
+
+		private void Trim ()
+		{
+			while (entries.Count > capacity) {
+				RemoveNode (recentlyUsed.Last);
+				EvictionCount++;
+			}
+		}
+
+		private void RemoveNode (LinkedListNode<TextBlobEntry> node)
+		{
+			recentlyUsed.Remove (node);
+			entries.Remove (node.Value.Key);
+			node.Value.Blob?.Dispose ();
+		}
+
+		private sealed class TextBlobEntry
+		{
+			public TextBlobEntry (TextBlobKey key, IntPtr typeface, SKTextBlob blob)
+			{
+				Key = key;
+				Typeface = typeface;
+				Blob = blob;
+			}
+
+			public TextBlobKey Key { get; }
+
+			// the cached blob holds a reference to the typeface, so the handle
+			// cannot be reused by another typeface while the entry exists
+			public IntPtr Typeface { get; }
+
+			public SKTextBlob Blob { get; }
+
+			// the advance width, only measured when an aligned draw needs it
+			public float? Width { get; set; }
+		}
+
+		// a font is identified by the instance and the version, which changes
+		// with every setter, so a lookup makes no native calls at all
+		private readonly struct TextBlobKey : IEquatable<TextBlobKey>
+		{
+			public TextBlobKey (string text, SKFont font)
+			{
+				Text = text;
+				Font = font;
+				FontVersion = font.Version;
+			}
+
+			public string Text { get; }
+
+			public SKFont Font { get; }
+
+			public int FontVersion { get; }
+
+			public bool Equals (TextBlobKey obj) =>
+				ReferenceEquals (Font, obj.Font) &&
+				FontVersion == obj.FontVersion &&
+				Text == obj.Text;
+
+			public override bool Equals (object obj) =>
+				obj is TextBlobKey k && Equals (k);
+
+			public override int GetHashCode ()
+			{
+				var hash = new HashCode ();
+				hash.Add (Text);
+				hash.Add (RuntimeHelpers.GetHashCode (Font));
+				hash.Add (FontVersion);
+				return hash.ToHashCode ();
+			}
+		}
+	}
+}
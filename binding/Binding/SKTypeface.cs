@@ -17,19 +17,17 @@ namespace SkiaSharp
 
 	public unsafe class SKTypeface : SKObject, ISKReferenceCounted
 	{
-		private static readonly SKTypeface defaultTypeface;
+		private static readonly Lazy<SKTypeface> defaultTypeface =
+			new Lazy<SKTypeface> (() => SKStartupTrace.Measure ("SKTypeface.Default", () =>
+				new SKTypefaceStatic (SkiaApi.sk_typeface_ref_default ())));
 
 		private SKFont font;
 
-		static SKTypeface ()
-		{
-			defaultTypeface = new SKTypefaceStatic (SkiaApi.sk_typeface_ref_default ());
-		}
-
 		internal static void EnsureStaticInstanceAreInitialized ()
 		{
 			// IMPORTANT: do not remove to ensure that the static instances
-			//            are initialized before any access is made to them
+			//            are registered before any other wrapper for the same handle
+			_ = defaultTypeface.Value;
 		}
 
 		internal SKTypeface (IntPtr handle, bool owns)
@@ -42,7 +40,7 @@ namespace SkiaSharp
 		protected override void Dispose (bool disposing) =>
 			base.Dispose (disposing);
 
-		public static SKTypeface Default => defaultTypeface;
+		public static SKTypeface Default => defaultTypeface.Value;
 
 		public static SKTypeface CreateDefault ()
 		{
@@ -450,8 +448,14 @@ namespace SkiaSharp
 
 		//
 
-		internal static SKTypeface GetObject (IntPtr handle) =>
-			GetOrAddObject (handle, (h, o) => new SKTypeface (h, o));
+		internal static SKTypeface GetObject (IntPtr handle)
+		{
+			if (handle == IntPtr.Zero)
+				return null;
+
+			EnsureStaticInstanceAreInitialized ();
+			return GetOrAddObject (handle, (h, o) => new SKTypeface (h, o));
+		}
 
 		//
 
@@ -12,7 +12,8 @@ namespace SkiaSharp
 
 #if USE_DELEGATES
 		private static readonly Lazy<IntPtr> libSkiaSharpHandle =
-			new Lazy<IntPtr> (() => LibraryLoader.LoadLocalLibrary<SkiaApi> (SKIA));
+			new Lazy<IntPtr> (() => SKStartupTrace.Measure (nameof (LibraryLoader.LoadLocalLibrary), () =>
+				LibraryLoader.LoadLocalLibrary<SkiaApi> (SKIA)));
 
 		private static T GetSymbol<T> (string name) where T : Delegate =>
 			LibraryLoader.GetSymbolDelegate<T> (libSkiaSharpHandle.Value, name);
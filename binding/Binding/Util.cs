@@ -1,7 +1,10 @@
 ﻿using System;
 using System.Buffers;
 using System.ComponentModel;
+using System.Runtime.ExceptionServices;
 using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
 #if NETSTANDARD1_3 || WINDOWS_UWP
 using System.Reflection;
 #endif
@@ -92,6 +95,52 @@ namespace SkiaSharp
 				scope.Span;
 		}
 
+		// runs the body for each index on up to the number of threads,
+		// including the calling thread
+		internal static void ParallelFor (int count, int maxDegreeOfParallelism, Action<int> body)
+		{
+			var workers = Math.Min (count, maxDegreeOfParallelism) - 1;
+			if (workers <= 0) {
+				for (var i = 0; i < count; i++)
+					body (i);
+				return;
+			}
+
+			var next = -1;
+			void Work ()
+			{
+				try {
+					int i;
+					while ((i = Interlocked.Increment (ref next)) < count)
+						body (i);
+				} catch {
+					// stop the other threads from starting anything new
+					Interlocked.Exchange (ref next, count);
+					throw;
+				}
+			}
+
+			var tasks = new Task[workers];
+			for (var t = 0; t < workers; t++)
+				tasks[t] = Task.Run (Work);
+
+			// make sure that nothing is still running before returning
+			Exception error = null;
+			try {
+				Work ();
+			} catch (Exception ex) {
+				error = ex;
+			}
+			try {
+				Task.WaitAll (tasks);
+			} catch (AggregateException ex) {
+				error ??= ex.InnerException;
+			}
+
+			if (error != null)
+				ExceptionDispatchInfo.Capture (error).Throw ();
+		}
+
 #if NETSTANDARD1_3 || WINDOWS_UWP
 		internal static bool IsAssignableFrom (this Type type, Type c) =>
 			type.GetTypeInfo ().IsAssignableFrom (c.GetTypeInfo ());
@@ -33,7 +33,7 @@ namespace SkiaSharp.Tests
 				.Cast<SKObject>()
 				.ToList();
 			var staticChildren = staticObjects
-				.SelectMany(o => o.OwnedObjects.Values)
+				.SelectMany(o => o.GetOwnedObjects())
 				.ToList();
 
 			// make sure nothing is alive
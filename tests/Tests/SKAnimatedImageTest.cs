@@ -0,0 +1,321 @@
+﻿using System;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKAnimatedImageTest : SKTest
+	{
+		private const int HeartFrameCount = 16;
+
+		private static readonly string HeartPath = Path.Combine(PathToImages, "animated-heart.gif");
+
+		[SkippableFact]
+		public void CanCreateAnimatedImage()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+
+			Assert.NotNull(image);
+			Assert.Equal(HeartFrameCount, image.FrameCount);
+			Assert.Equal(-1, image.RepetitionCount);
+			Assert.Equal(SKAlphaType.Premul, image.Info.AlphaType);
+
+			var total = TimeSpan.Zero;
+			for (var i = 0; i < image.FrameCount; i++)
+			{
+				Assert.Equal(total, image.GetFrameStart(i));
+				Assert.Equal(i, image.GetFrameIndex(total));
+				total += image.GetFrameDuration(i);
+			}
+			Assert.Equal(total, image.Duration);
+		}
+
+		[SkippableFact]
+		public void StillImageHasOneFrame()
+		{
+			using var image = SKAnimatedImage.Create(Path.Combine(PathToImages, "baboon.png"));
+			using var player = image.CreatePlayer();
+
+			Assert.Equal(1, image.FrameCount);
+			Assert.Equal(TimeSpan.Zero, image.Duration);
+
+			Assert.True(player.Advance(TimeSpan.FromSeconds(1)));
+			Assert.True(player.IsCompleted);
+			Assert.Equal(0, player.CurrentFrameIndex);
+			Assert.NotNull(player.CurrentFrame);
+		}
+
+		[SkippableFact]
+		public void InvalidDataReturnsNull()
+		{
+			using var data = SKData.CreateCopy(new byte[] { 1, 2, 3, 4 });
+
+			Assert.Null(SKAnimatedImage.Create(data));
+		}
+
+		[SkippableFact]
+		public void ComposedFramesMatchCodec()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			using var codec = SKCodec.Create(HeartPath);
+
+			for (var i = 0; i < image.FrameCount; i++)
+			{
+				using var expected = new SKBitmap(image.Info);
+				Assert.Equal(SKCodecResult.Success, codec.GetPixels(image.Info, expected.GetPixels(), new SKCodecOptions(i)));
+
+				using var frame = image.GetFrame(i);
+				using var actual = SKBitmap.FromImage(frame.Image);
+
+				Assert.Equal(i, frame.Index);
+				Assert.Equal(expected.Bytes, actual.Bytes);
+			}
+		}
+
+		[SkippableFact]
+		public void SequentialFramesAreDecodedOnce()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+
+			for (var i = 0; i < image.FrameCount; i++)
+			{
+				using var frame = image.GetFrame(i);
+				Assert.NotNull(frame.Image);
+			}
+
+			Assert.Equal(HeartFrameCount, image.DecodedFrameCount);
+			Assert.Equal(HeartFrameCount, image.CachedFrameCount);
+
+			using (var again = image.GetFrame(5))
+				Assert.NotNull(again.Image);
+
+			Assert.Equal(HeartFrameCount, image.DecodedFrameCount);
+		}
+
+		[SkippableFact]
+		public void DependentFrameComposesRequiredFrames()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			var last = image.FrameCount - 1;
+
+			using (var frame = image.GetFrame(last))
+				Assert.NotNull(frame.Image);
+
+			// the required frames are cached along the way
+			Assert.True(image.DecodedFrameCount >= 1);
+			Assert.True(image.DecodedFrameCount <= image.FrameCount);
+
+			var decoded = image.DecodedFrameCount;
+			var required = image.FrameInfo[last].RequiredFrame;
+			if (required >= 0)
+			{
+				using var frame = image.GetFrame(required);
+				Assert.Equal(decoded, image.DecodedFrameCount);
+			}
+		}
+
+		[SkippableFact]
+		public void TryGetFrameDoesNotDecode()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+
+			Assert.False(image.TryGetFrame(3, out var frame));
+			Assert.Null(frame);
+			Assert.Equal(0, image.DecodedFrameCount);
+
+			image.GetFrame(3).Dispose();
+
+			Assert.True(image.TryGetFrame(3, out frame));
+			Assert.Equal(3, frame.Index);
+			frame.Dispose();
+		}
+
+		[SkippableFact]
+		public void PrefetchingStaysUnderTheMemoryCap()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			image.MaxBytes = image.Info.BytesSize64 * 3;
+
+			for (var i = 0; i < image.FrameCount; i++)
+				image.Prefetch(i);
+
+			WaitForPrefetching(image);
+
+			Assert.True(image.CachedFrameCount > 0);
+			Assert.True(image.CachedFrameCount <= 3);
+			Assert.True(image.CurrentBytes <= image.MaxBytes);
+		}
+
+		[SkippableFact]
+		public void PrefetchDecodesInTheBackground()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+
+			for (var i = 0; i < 4; i++)
+				image.Prefetch(i);
+
+			WaitForPrefetching(image);
+
+			for (var i = 0; i < 4; i++)
+			{
+				Assert.True(image.TryGetFrame(i, out var frame));
+				frame.Dispose();
+			}
+		}
+
+		[SkippableFact]
+		public void FrameIsValidAfterEviction()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+
+			using var frame = image.GetFrame(0);
+			image.Clear();
+
+			Assert.Equal(0, image.CachedFrameCount);
+			Assert.NotNull(frame.Image);
+			Assert.Equal(image.Info.Width, frame.Image.Width);
+
+			using var pixmap = frame.Image.PeekPixels();
+			Assert.NotNull(pixmap);
+		}
+
+		[SkippableFact]
+		public void PlayerShowsFirstFrameImmediately()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			using var player = image.CreatePlayer();
+
+			Assert.Equal(-1, player.CurrentFrameIndex);
+			Assert.Null(player.CurrentFrame);
+
+			Assert.True(player.Advance(TimeSpan.Zero));
+
+			Assert.Equal(0, player.CurrentFrameIndex);
+			Assert.NotNull(player.CurrentFrame);
+			Assert.Equal(1, player.PresentedFrameCount);
+		}
+
+		[SkippableFact]
+		public void PlayerAdvancesThroughDecodedFrames()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			using var player = image.CreatePlayer();
+			DecodeAll(image);
+
+			player.Advance(TimeSpan.Zero);
+
+			Assert.True(player.Advance(image.GetFrameDuration(0)));
+			Assert.Equal(1, player.CurrentFrameIndex);
+			Assert.Equal(0, player.DroppedFrameCount);
+
+			// jumping three frames ahead skips two of them
+			var skip = image.GetFrameStart(4) - player.Position;
+			Assert.True(player.Advance(skip));
+			Assert.Equal(4, player.CurrentFrameIndex);
+			Assert.Equal(2, player.DroppedFrameCount);
+			Assert.Equal(3, player.PresentedFrameCount);
+		}
+
+		[SkippableFact]
+		public void PlayerKeepsFrameWhenNextIsNotReady()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			using var player = image.CreatePlayer();
+			player.LookAhead = 0;
+
+			player.Advance(TimeSpan.Zero);
+			image.Clear();
+
+			Assert.False(player.Advance(image.GetFrameDuration(0)));
+			Assert.Equal(0, player.CurrentFrameIndex);
+			Assert.Equal(1, player.LateFrameCount);
+
+			WaitForPrefetching(image);
+
+			Assert.True(player.Advance(TimeSpan.Zero));
+			Assert.Equal(1, player.CurrentFrameIndex);
+			Assert.Equal(0, player.DroppedFrameCount);
+		}
+
+		[SkippableFact]
+		public void PlayerAdvancesWhenTheCapIsSmallerThanTwoFrames()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			image.MaxBytes = image.Info.BytesSize64 * 3 / 2;
+			using var player = image.CreatePlayer();
+
+			Assert.True(player.Advance(TimeSpan.Zero));
+
+			for (var i = 1; i < HeartFrameCount; i++)
+			{
+				Assert.True(player.Advance(image.GetFrameDuration(i - 1)));
+				Assert.Equal(i, player.CurrentFrameIndex);
+				Assert.True(image.CurrentBytes <= image.MaxBytes);
+			}
+
+			Assert.Equal(0, player.LateFrameCount);
+			Assert.Equal(0, player.DroppedFrameCount);
+			Assert.Equal(HeartFrameCount, player.PresentedFrameCount);
+		}
+
+		[SkippableFact]
+		public void PlayerLoops()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			using var player = image.CreatePlayer();
+			DecodeAll(image);
+
+			player.Seek(image.Duration + image.GetFrameStart(2));
+
+			Assert.Equal(1, player.CompletedLoops);
+			Assert.Equal(2, player.CurrentFrameIndex);
+			Assert.Equal(image.GetFrameStart(2), player.Position);
+			Assert.False(player.IsCompleted);
+		}
+
+		[SkippableFact]
+		public void PlayersShareFrames()
+		{
+			using var image = SKAnimatedImage.Create(HeartPath);
+			using var first = image.CreatePlayer();
+			using var second = image.CreatePlayer();
+
+			first.Advance(TimeSpan.Zero);
+			second.Advance(TimeSpan.Zero);
+			WaitForPrefetching(image);
+
+			Assert.Same(first.CurrentFrame, second.CurrentFrame);
+			Assert.Equal(1 + first.LookAhead, image.DecodedFrameCount);
+		}
+
+		[SkippableFact]
+		public void DisposingImageWithPlayersIsSafe()
+		{
+			var image = SKAnimatedImage.Create(HeartPath);
+			var player = image.CreatePlayer();
+
+			player.Advance(TimeSpan.Zero);
+			image.Dispose();
+
+			Assert.NotNull(player.CurrentFrame);
+			player.Dispose();
+		}
+
+		private static void DecodeAll(SKAnimatedImage image)
+		{
+			for (var i = 0; i < image.FrameCount; i++)
+				image.GetFrame(i).Dispose();
+		}
+
+		private static void WaitForPrefetching(SKAnimatedImage image)
+		{
+			var timeout = DateTime.UtcNow.AddSeconds(10);
+			while (image.IsPrefetching && DateTime.UtcNow < timeout)
+				Thread.Sleep(10);
+
+			Assert.False(image.IsPrefetching);
+		}
+	}
+}
@@ -739,5 +739,42 @@ namespace SkiaSharp.Tests
 
 			Assert.NotNull(bitmap);
 		}
+
+		[SkippableTheory]
+		[InlineData("baboon.png")]
+		[InlineData("baboon.jpg")]
+		public async Task DecodeAsyncMatchesDecode(string image)
+		{
+			var path = Path.Combine(PathToImages, image);
+
+			using var stream = new ThrottledStream(File.ReadAllBytes(path), 4096);
+			using var bitmap = await SKBitmap.DecodeAsync(stream);
+			using var expected = SKBitmap.Decode(path);
+
+			Assert.Equal(expected.Info, bitmap.Info);
+			Assert.Equal(expected.Pixels, bitmap.Pixels);
+		}
+
+		[SkippableFact]
+		public async Task DecodeAsyncWithInfoMatchesDecode()
+		{
+			var path = Path.Combine(PathToImages, "baboon.png");
+			var info = new SKImageInfo(512, 512, SKColorType.Rgba8888, SKAlphaType.Premul);
+
+			using var stream = File.OpenRead(path);
+			using var bitmap = await SKBitmap.DecodeAsync(stream, info);
+			using var expected = SKBitmap.Decode(path, info);
+
+			Assert.Equal(info, bitmap.Info);
+			Assert.Equal(expected.Pixels, bitmap.Pixels);
+		}
+
+		[SkippableFact]
+		public async Task DecodeAsyncReturnsNullForInvalidData()
+		{
+			using var stream = new MemoryStream(new byte[1000]);
+
+			Assert.Null(await SKBitmap.DecodeAsync(stream));
+		}
 	}
 }
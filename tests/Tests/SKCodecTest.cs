@@ -491,5 +491,19 @@ namespace SkiaSharp.Tests
 			Assert.Equal(SKCodecResult.Success, codec.GetPixels(out var pixels));
 			Assert.NotEmpty(pixels);
 		}
+
+		[SkippableFact]
+		public async Task CreateAsyncReadsThrottledStream()
+		{
+			var path = Path.Combine(PathToImages, "baboon.png");
+
+			using var stream = new ThrottledStream(File.ReadAllBytes(path), 4096);
+			using var codec = await SKCodec.CreateAsync(stream);
+			using var expected = SKCodec.Create(path);
+
+			Assert.NotNull(codec);
+			Assert.Equal(expected.Info, codec.Info);
+			Assert.Equal(expected.Pixels, codec.Pixels);
+		}
 	}
 }
@@ -0,0 +1,126 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKColorConverterTest : SKTest
+	{
+		private static SKBitmap CreateSource(int width, int height, SKColorSpace colorSpace)
+		{
+			var bitmap = new SKBitmap(new SKImageInfo(width, height, SKColorType.Rgba8888, SKAlphaType.Unpremul, colorSpace));
+
+			// every channel value, with some alpha, so that the transfer
+			// functions and the premultiplication are all exercised
+			var random = new Random(42);
+			var bytes = new byte[bitmap.ByteCount];
+			random.NextBytes(bytes);
+			for (var i = 0; i < bytes.Length; i += 4)
+				bytes[i] = (byte)(i / 4);
+			Marshal.Copy(bytes, 0, bitmap.GetPixels(), bytes.Length);
+
+			return bitmap;
+		}
+
+		private static byte[] ConvertSerially(SKBitmap source, SKImageInfo info)
+		{
+			using var destination = new SKBitmap(info);
+			using var pixmap = source.PeekPixels();
+			Assert.True(pixmap.ReadPixels(destination.Info, destination.GetPixels(), destination.RowBytes));
+			return destination.Bytes;
+		}
+
+		private static SKColorSpace GetColorSpace(string name) =>
+			name switch
+			{
+				"srgb" => SKColorSpace.CreateSrgb(),
+				"linear" => SKColorSpace.CreateSrgbLinear(),
+				"adobe" => SKColorSpace.CreateRgb(SKColorSpaceTransferFn.TwoDotTwo, SKColorSpaceXyz.AdobeRgb),
+				_ => throw new ArgumentException(name),
+			};
+
+		[SkippableTheory]
+		[InlineData(SKColorType.Rgba8888, SKAlphaType.Premul, "srgb")]
+		[InlineData(SKColorType.Bgra8888, SKAlphaType.Unpremul, "srgb")]
+		[InlineData(SKColorType.Rgba8888, SKAlphaType.Premul, "adobe")]
+		[InlineData(SKColorType.RgbaF16, SKAlphaType.Premul, "srgb")]
+		[InlineData(SKColorType.RgbaF16, SKAlphaType.Premul, "linear")]
+		[InlineData(SKColorType.RgbaF32, SKAlphaType.Unpremul, "linear")]
+		public void ConversionMatchesReadPixels(SKColorType colorType, SKAlphaType alphaType, string colorSpace)
+		{
+			using var p3 = SKColorSpace.CreateRgb(SKColorSpaceTransferFn.Srgb, SKColorSpaceXyz.DisplayP3);
+			using var source = CreateSource(1024, 1024, p3);
+			var info = new SKImageInfo(1024, 1024, colorType, alphaType, GetColorSpace(colorSpace));
+
+			var expected = ConvertSerially(source, info);
+
+			using var destination = new SKBitmap(info);
+			using var sourcePixmap = source.PeekPixels();
+			using var destinationPixmap = destination.PeekPixels();
+
+			Assert.True(SKColorConverter.Convert(sourcePixmap, destinationPixmap));
+			Assert.Equal(expected, destination.Bytes);
+		}
+
+		[SkippableTheory]
+		[InlineData(1)]
+		[InlineData(2)]
+		[InlineData(3)]
+		[InlineData(16)]
+		public void EveryDegreeOfParallelismGivesTheSameResult(int maxDegreeOfParallelism)
+		{
+			using var p3 = SKColorSpace.CreateRgb(SKColorSpaceTransferFn.Srgb, SKColorSpaceXyz.DisplayP3);
+
+			// an odd height so that the last band is shorter
+			using var source = CreateSource(777, 1001, p3);
+			var info = new SKImageInfo(777, 1001, SKColorType.RgbaF16, SKAlphaType.Premul, SKColorSpace.CreateSrgbLinear());
+
+			var expected = ConvertSerially(source, info);
+
+			using var destination = new SKBitmap(info);
+			using var sourcePixmap = source.PeekPixels();
+			using var destinationPixmap = destination.PeekPixels();
+
+			Assert.True(SKColorConverter.Convert(sourcePixmap, destinationPixmap, maxDegreeOfParallelism));
+			Assert.Equal(expected, destination.Bytes);
+		}
+
+		[SkippableTheory]
+		[InlineData(256, 512 * 4, 8, 256)]
+		[InlineData(3000, 4000 * 4, 1, 3000)]
+		[InlineData(3000, 4000 * 4, 2, 375)]
+		[InlineData(3000, 4000 * 4, 8, 94)]
+		[InlineData(1001, 777 * 8, 16, 16)]
+		public void OnlyLargeImagesOnSeveralThreadsAreSplit(int height, int rowBytes, int maxDegreeOfParallelism, int bandRows)
+		{
+			Assert.Equal(bandRows, SKColorConverter.GetBandRows(height, rowBytes, maxDegreeOfParallelism));
+		}
+
+		[SkippableFact]
+		public void SmallImagesAreConverted()
+		{
+			using var source = CreateSource(3, 2, SKColorSpace.CreateSrgb());
+			var info = new SKImageInfo(3, 2, SKColorType.RgbaF16, SKAlphaType.Premul, SKColorSpace.CreateSrgbLinear());
+
+			var expected = ConvertSerially(source, info);
+
+			using var destination = new SKBitmap(info);
+			using var sourcePixmap = source.PeekPixels();
+			using var destinationPixmap = destination.PeekPixels();
+
+			Assert.True(SKColorConverter.Convert(sourcePixmap, destinationPixmap));
+			Assert.Equal(expected, destination.Bytes);
+		}
+
+		[SkippableFact]
+		public void PixmapsOfDifferentSizesThrow()
+		{
+			using var source = CreateSource(10, 10, SKColorSpace.CreateSrgb());
+			using var destination = new SKBitmap(new SKImageInfo(10, 20, SKColorType.RgbaF16, SKAlphaType.Premul, SKColorSpace.CreateSrgbLinear()));
+			using var sourcePixmap = source.PeekPixels();
+			using var destinationPixmap = destination.PeekPixels();
+
+			Assert.Throws<ArgumentException>(() => SKColorConverter.Convert(sourcePixmap, destinationPixmap));
+		}
+	}
+}
@@ -1,6 +1,8 @@
 ﻿using System;
 using System.IO;
 using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
 using Xunit;
 
 namespace SkiaSharp.Tests
@@ -199,5 +201,40 @@ namespace SkiaSharp.Tests
 			// since the data was nuked, they will differ
 			Assert.NotEqual(OddData, buffer);
 		}
+
+		[SkippableFact]
+		public async Task CreateAsyncReadsSeekableStream()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.png"));
+
+			using var stream = new MemoryStream(bytes);
+			using var data = await SKData.CreateAsync(stream);
+
+			Assert.Equal(bytes, data.ToArray());
+		}
+
+		[SkippableFact]
+		public async Task CreateAsyncReadsNonSeekableStream()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.png"));
+
+			using var stream = new ThrottledStream(bytes, 1000);
+			using var data = await SKData.CreateAsync(stream);
+
+			Assert.Equal(bytes, data.ToArray());
+			Assert.True(stream.ReadCount > 1);
+		}
+
+		[SkippableFact]
+		public async Task CreateAsyncCanBeCancelled()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.png"));
+
+			using var stream = new ThrottledStream(bytes, 1000);
+			using var cts = new CancellationTokenSource();
+			cts.Cancel();
+
+			await Assert.ThrowsAnyAsync<OperationCanceledException>(() => SKData.CreateAsync(stream, cts.Token));
+		}
 	}
 }
@@ -1,4 +1,5 @@
-﻿using Xunit;
+﻿using System.Linq;
+using Xunit;
 
 namespace SkiaSharp.Tests
 {
@@ -53,6 +54,216 @@ namespace SkiaSharp.Tests
 				Assert.Equal(SKColors.Blue, bmp.GetPixel(50, 50));
 			}
 		}
+
+		[SkippableFact]
+		public void CachedDrawableIsRenderedOnce()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			using var bmp = new SKBitmap(200, 200);
+			using var canvas = new SKCanvas(bmp);
+
+			canvas.DrawDrawable(drawable, 0, 0);
+			canvas.DrawDrawable(drawable, 0, 0);
+			drawable.Draw(canvas, 0, 0);
+
+			Assert.Equal(1, drawable.DrawFireCount);
+			Assert.Equal(SKColors.Blue, bmp.GetPixel(50, 50));
+			Assert.Equal(SKColors.Empty, bmp.GetPixel(150, 150));
+		}
+
+		[SkippableFact]
+		public void CachedDrawableIsNotRenderedAgainWhenTranslated()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			using var bmp = new SKBitmap(200, 200);
+			using var canvas = new SKCanvas(bmp);
+
+			canvas.DrawDrawable(drawable, 0, 0);
+			canvas.DrawDrawable(drawable, 100, 100);
+
+			Assert.Equal(1, drawable.DrawFireCount);
+			Assert.Equal(SKColors.Blue, bmp.GetPixel(150, 150));
+			Assert.Equal(SKColors.Empty, bmp.GetPixel(150, 50));
+		}
+
+		[SkippableFact]
+		public void CachedDrawableIsRenderedAgainWhenChanged()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			using var bmp = new SKBitmap(100, 100);
+			using var canvas = new SKCanvas(bmp);
+
+			canvas.DrawDrawable(drawable, 0, 0);
+			drawable.NotifyDrawingChanged();
+			canvas.DrawDrawable(drawable, 0, 0);
+
+			Assert.Equal(2, drawable.DrawFireCount);
+		}
+
+		[SkippableFact]
+		public void CachedDrawableIsRenderedAgainForNewScaleBucket()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			using var bmp = new SKBitmap(300, 300);
+			using var canvas = new SKCanvas(bmp);
+
+			canvas.DrawDrawable(drawable, 0, 0);
+
+			// a small change stays in the same bucket
+			canvas.Save();
+			canvas.Scale(1.01f);
+			canvas.DrawDrawable(drawable, 0, 0);
+			canvas.Restore();
+			Assert.Equal(1, drawable.DrawFireCount);
+
+			canvas.Save();
+			canvas.Scale(2);
+			canvas.DrawDrawable(drawable, 0, 0);
+			canvas.Restore();
+			Assert.Equal(2, drawable.DrawFireCount);
+			Assert.Equal(SKColors.Blue, bmp.GetPixel(190, 190));
+		}
+
+		[SkippableFact]
+		public void DrawableWithPerspectiveIsNotCached()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			using var bmp = new SKBitmap(100, 100);
+			using var canvas = new SKCanvas(bmp);
+
+			var matrix = SKMatrix.Identity;
+			matrix.Persp0 = 0.001f;
+
+			canvas.DrawDrawable(drawable, ref matrix);
+			canvas.DrawDrawable(drawable, ref matrix);
+
+			Assert.Equal(2, drawable.DrawFireCount);
+		}
+
+		[SkippableFact]
+		public void CachedDrawableIsRecordedAsDrawing()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			var misses = SKDrawableCache.MissCount;
+
+			SKPicture picture;
+			using (var recorder = new SKPictureRecorder())
+			{
+				var canvas = recorder.BeginRecording(SKRect.Create(200, 200));
+				canvas.DrawDrawable(drawable, 0, 0);
+				drawable.Draw(canvas, 0, 0);
+				picture = recorder.EndRecording();
+			}
+
+			Assert.Equal(misses, SKDrawableCache.MissCount);
+
+			// the drawing fills the whole clip, where an image would only
+			// cover the bounds of the drawable
+			using (picture)
+			using (var bmp = new SKBitmap(200, 200))
+			using (var canvas = new SKCanvas(bmp))
+			{
+				canvas.Clear(SKColors.Transparent);
+				canvas.DrawPicture(picture);
+
+				Assert.Equal(SKColors.Blue, bmp.GetPixel(50, 50));
+				Assert.Equal(SKColors.Blue, bmp.GetPixel(150, 150));
+			}
+		}
+
+		[SkippableFact]
+		public void CachedDrawableIsNotRasterizedIntoDocument()
+		{
+			using var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			var misses = SKDrawableCache.MissCount;
+
+			using var stream = new SKDynamicMemoryWStream();
+			using (var document = SKDocument.CreatePdf(stream))
+			{
+				var canvas = document.BeginPage(200, 200);
+				canvas.DrawDrawable(drawable, 0, 0);
+				document.EndPage();
+				document.Close();
+			}
+
+			Assert.Equal(misses, SKDrawableCache.MissCount);
+			Assert.True(stream.BytesWritten > 0);
+		}
+
+		[SkippableTheory]
+		[InlineData(1, 0, 0, 1, true)]
+		[InlineData(2, 0, 0, 2, true)]
+		[InlineData(0, -1, 1, 0, true)]
+		[InlineData(1, 0.5f, 0, 1, false)]
+		[InlineData(-1, 0, 0, 1, false)]
+		[InlineData(0, 0, 0, 0, false)]
+		public void RasterCacheBucketsOnlyScaleAndRotation(float scaleX, float skewX, float skewY, float scaleY, bool cached)
+		{
+			var matrix = new SKMatrix(scaleX, skewX, 10, skewY, scaleY, 20, 0, 0, 1);
+
+			Assert.Equal(cached, SKDrawableCache.TryGetBuckets(matrix, out _));
+		}
+
+		[SkippableFact]
+		public void RasterCacheBucketsIgnoreTranslation()
+		{
+			Assert.True(SKDrawableCache.TryGetBuckets(SKMatrix.CreateScale(1.5f, 1.5f), out var first));
+			Assert.True(SKDrawableCache.TryGetBuckets(SKMatrix.CreateScale(1.5f, 1.5f).PostConcat(SKMatrix.CreateTranslation(33.3f, 7)), out var second));
+			Assert.True(SKDrawableCache.TryGetBuckets(SKMatrix.CreateRotationDegrees(30), out var rotated));
+
+			Assert.True(first.Matches(second));
+			Assert.False(first.Matches(rotated));
+		}
+
+		[SkippableFact]
+		public void DisposedDrawableIsRemovedFromCache()
+		{
+			var drawable = new TestDrawable { IsRasterCacheEnabled = true };
+			using var bmp = new SKBitmap(100, 100);
+			using var canvas = new SKCanvas(bmp);
+
+			var before = SKDrawableCache.CurrentBytes;
+			canvas.DrawDrawable(drawable, 0, 0);
+			Assert.Equal(before + 100 * 100 * 4, SKDrawableCache.CurrentBytes);
+
+			drawable.Dispose();
+			Assert.Equal(before, SKDrawableCache.CurrentBytes);
+		}
+
+		[SkippableFact]
+		public void RasterCacheStaysWithinBudget()
+		{
+			var maxBytes = SKDrawableCache.MaxBytes;
+			var drawables = Enumerable.Range(0, 10).Select(_ => new TestDrawable { IsRasterCacheEnabled = true }).ToArray();
+			try
+			{
+				SKDrawableCache.Clear();
+				SKDrawableCache.MaxBytes = 100 * 100 * 4 * 4;
+
+				using var bmp = new SKBitmap(100, 100);
+				using var canvas = new SKCanvas(bmp);
+
+				foreach (var drawable in drawables)
+					canvas.DrawDrawable(drawable, 0, 0);
+
+				Assert.True(SKDrawableCache.CurrentBytes <= SKDrawableCache.MaxBytes);
+				Assert.Equal(4, SKDrawableCache.Count);
+
+				// the most recent drawables are still cached
+				canvas.DrawDrawable(drawables[9], 0, 0);
+				Assert.Equal(1, drawables[9].DrawFireCount);
+
+				// the oldest were evicted
+				canvas.DrawDrawable(drawables[0], 0, 0);
+				Assert.Equal(2, drawables[0].DrawFireCount);
+			}
+			finally
+			{
+				foreach (var drawable in drawables)
+					drawable.Dispose();
+				SKDrawableCache.MaxBytes = maxBytes;
+			}
+		}
 	}
 
 	class TestDrawable : SKDrawable
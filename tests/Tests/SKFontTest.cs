@@ -188,6 +188,123 @@ namespace SkiaSharp.Tests
 			Assert.Equal(0, font.MeasureText(""));
 		}
 
+		[SkippableFact]
+		public void MeasureTextBatchMatchesMeasureText()
+		{
+			using var font = new SKFont();
+			var texts = new[] { "Hello World!", "", "SkiaSharp", "ä", null, "a b c" };
+
+			var widths = new float[texts.Length];
+			font.MeasureText(texts, widths);
+
+			for (var i = 0; i < texts.Length; i++)
+				Assert.Equal(font.MeasureText(texts[i] ?? ""), widths[i], 3);
+		}
+
+		[SkippableFact]
+		public void MeasureTextBatchReturnsTheBounds()
+		{
+			using var font = new SKFont();
+			var texts = new[] { "Hello World!", " ", "Typography", "g" };
+
+			var widths = new float[texts.Length];
+			var bounds = new SKRect[texts.Length];
+			font.MeasureText(texts, widths, bounds);
+
+			for (var i = 0; i < texts.Length; i++)
+			{
+				var expectedWidth = font.MeasureText(texts[i], out var expectedBounds);
+
+				Assert.Equal(expectedWidth, widths[i], 3);
+				Assert.Equal(expectedBounds.Left, bounds[i].Left, 3);
+				Assert.Equal(expectedBounds.Top, bounds[i].Top, 3);
+				Assert.Equal(expectedBounds.Right, bounds[i].Right, 3);
+				Assert.Equal(expectedBounds.Bottom, bounds[i].Bottom, 3);
+			}
+		}
+
+		[SkippableFact]
+		public void MeasureTextBatchMeasuresRangesOfOneBuffer()
+		{
+			using var font = new SKFont();
+			var text = "OneTwoThree\U0001F600Four";
+			var lengths = new[] { 3, 3, 0, 5, 2, 4 };
+
+			var widths = new float[lengths.Length];
+			font.MeasureText(text.AsSpan(), lengths, widths);
+
+			var offset = 0;
+			for (var i = 0; i < lengths.Length; i++)
+			{
+				var expected = font.MeasureText(text.Substring(offset, lengths[i]));
+				Assert.Equal(expected, widths[i], 3);
+				offset += lengths[i];
+			}
+		}
+
+		[SkippableFact]
+		public void MeasureTextBatchHandlesUnpairedSurrogates()
+		{
+			using var font = new SKFont();
+			var text = "ab\uD83Dcd";
+			var lengths = new[] { 3, 2 };
+
+			var widths = new float[lengths.Length];
+			font.MeasureText(text.AsSpan(), lengths, widths);
+
+			Assert.Equal(font.MeasureText(text.Substring(0, 3)), widths[0], 3);
+			Assert.Equal(font.MeasureText(text.Substring(3, 2)), widths[1], 3);
+		}
+
+		[SkippableFact]
+		public void MeasureTextBatchWithPaintMatchesMeasureText()
+		{
+			using var font = new SKFont();
+			using var paint = new SKPaint { Style = SKPaintStyle.Stroke, StrokeWidth = 4 };
+			var texts = new[] { "Hello", "World!" };
+
+			var widths = new float[texts.Length];
+			var bounds = new SKRect[texts.Length];
+			font.MeasureText(texts, widths, bounds, paint);
+
+			for (var i = 0; i < texts.Length; i++)
+			{
+				var expectedWidth = font.MeasureText(texts[i], out var expectedBounds, paint);
+
+				Assert.Equal(expectedWidth, widths[i], 3);
+				Assert.Equal(expectedBounds.Width, bounds[i].Width, 3);
+				Assert.Equal(expectedBounds.Height, bounds[i].Height, 3);
+			}
+		}
+
+		[SkippableFact]
+		public void MeasureTextBatchCachedAdvancesFollowTheFontSize()
+		{
+			using var font = new SKFont();
+			var texts = new[] { "Hello World!" };
+			var widths = new float[1];
+
+			font.MeasureText(texts, widths);
+			var small = widths[0];
+
+			font.Size *= 2;
+			font.MeasureText(texts, widths);
+
+			Assert.Equal(font.MeasureText(texts[0]), widths[0], 3);
+			Assert.True(widths[0] > small);
+		}
+
+		[SkippableFact]
+		public void MeasureTextBatchThrowsForMismatchedSpans()
+		{
+			using var font = new SKFont();
+			var texts = new[] { "a", "b" };
+
+			Assert.Throws<ArgumentException>(() => font.MeasureText(texts, new float[1]));
+			Assert.Throws<ArgumentException>(() => font.MeasureText(texts, new float[2], new SKRect[3]));
+			Assert.Throws<ArgumentOutOfRangeException>(() => font.MeasureText("abc".AsSpan(), new[] { 2, 2 }, new float[2]));
+		}
+
 		[SkippableFact]
 		public void GetGlyphWidthsReturnsTheCorrectAmount()
 		{
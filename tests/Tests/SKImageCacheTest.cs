@@ -0,0 +1,212 @@
+﻿using System;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKImageCacheTest : SKTest
+	{
+		[SkippableTheory]
+		[InlineData(0, 0, 0)]
+		[InlineData(1, 1, 32)]
+		[InlineData(100, 50, 128)]
+		[InlineData(50, 128, 128)]
+		[InlineData(129, 10, 256)]
+		public void SizeBucketIsCorrect(int width, int height, int bucket)
+		{
+			Assert.Equal(bucket, SKImageCache.GetSizeBucket(new SKSizeI(width, height)));
+		}
+
+		[SkippableTheory]
+		[InlineData(512, 1000, 750)]
+		[InlineData(1024, 1500, 1125)]
+		[InlineData(2048, 2500, 1875)]
+		[InlineData(4096, 4000, 3000)]
+		public void LargeJpegIsDecodedAtTheSmallestScaleThatIsLargeEnough(int bucket, int width, int height)
+		{
+			using var bitmap = new SKBitmap(4000, 3000);
+			bitmap.Erase(SKColors.CornflowerBlue);
+			using var jpeg = bitmap.Encode(SKEncodedImageFormat.Jpeg, 80);
+			using var codec = SKCodec.Create(jpeg);
+
+			var targetSize = SKImageCache.GetTargetSize(codec.Info.Size, bucket);
+			var decodeSize = SKImageCache.GetDecodeSize(codec, targetSize);
+
+			// the nearest eighth would be smaller than the target
+			Assert.Equal(new SKSizeI(width, height), decodeSize);
+			Assert.True(decodeSize.Width >= targetSize.Width);
+			Assert.True(decodeSize.Height >= targetSize.Height);
+
+			using var image = SKImageCache.Decode(jpeg, bucket);
+			Assert.Equal(targetSize, image.Info.Size);
+		}
+
+		[SkippableFact]
+		public void FullSizeImageIsCached()
+		{
+			var path = Path.Combine(PathToImages, "baboon.jpg");
+			using var cache = new SKImageCache();
+
+			using (var first = cache.GetImage(path))
+			{
+				Assert.NotNull(first.Image);
+				Assert.Equal(512, first.Image.Width);
+				Assert.Equal(512, first.Image.Height);
+			}
+
+			using (var second = cache.GetImage(path))
+			{
+				Assert.Equal(512, second.Image.Width);
+			}
+
+			Assert.Equal(1, cache.Count);
+			Assert.Equal(1, cache.MissCount);
+			Assert.Equal(1, cache.HitCount);
+			Assert.Equal(512 * 512 * 4, cache.CurrentBytes);
+		}
+
+		[SkippableTheory]
+		[InlineData("baboon.jpg")]
+		[InlineData("baboon.png")]
+		public void ImageIsDecodedAtTheSizeBucket(string filename)
+		{
+			var path = Path.Combine(PathToImages, filename);
+			using var cache = new SKImageCache();
+
+			using var cached = cache.GetImage(path, new SKSizeI(100, 100));
+
+			Assert.Equal(128, cached.Image.Width);
+			Assert.Equal(128, cached.Image.Height);
+			Assert.Equal(cached.Image.Info.BytesSize64, cache.CurrentBytes);
+		}
+
+		[SkippableFact]
+		public void SmallImagesAreNotUpscaled()
+		{
+			var path = Path.Combine(PathToImages, "color-wheel.png");
+			using var cache = new SKImageCache();
+
+			using var cached = cache.GetImage(path, new SKSizeI(1000, 1000));
+
+			Assert.Equal(128, cached.Image.Width);
+			Assert.Equal(128, cached.Image.Height);
+		}
+
+		[SkippableFact]
+		public void DifferentBucketsAreCachedSeparately()
+		{
+			var path = Path.Combine(PathToImages, "baboon.jpg");
+			using var cache = new SKImageCache();
+
+			cache.GetImage(path, new SKSizeI(100, 100)).Dispose();
+			cache.GetImage(path, new SKSizeI(120, 80)).Dispose();
+			cache.GetImage(path, new SKSizeI(60, 60)).Dispose();
+
+			Assert.Equal(2, cache.Count);
+			Assert.Equal(1, cache.HitCount);
+			Assert.Equal(2, cache.MissCount);
+			Assert.Equal(128 * 128 * 4 + 64 * 64 * 4, cache.CurrentBytes);
+		}
+
+		[SkippableFact]
+		public void LeastRecentlyUsedImagesAreEvictedByBytes()
+		{
+			var path = Path.Combine(PathToImages, "baboon.jpg");
+			using var cache = new SKImageCache(128 * 128 * 4 + 1);
+
+			cache.GetImage(path, new SKSizeI(128, 128)).Dispose();
+			cache.GetImage(path, new SKSizeI(64, 64)).Dispose();
+
+			Assert.Equal(1, cache.Count);
+			Assert.Equal(1, cache.EvictionCount);
+			Assert.Equal(64 * 64 * 4, cache.CurrentBytes);
+
+			cache.GetImage(path, new SKSizeI(64, 64)).Dispose();
+			Assert.Equal(1, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void LeasedImagesSurviveEviction()
+		{
+			var path = Path.Combine(PathToImages, "baboon.jpg");
+			using var cache = new SKImageCache();
+
+			using var cached = cache.GetImage(path, new SKSizeI(64, 64));
+			var image = cached.Image;
+
+			cache.Clear();
+
+			Assert.Equal(0, cache.Count);
+			Assert.Equal(0, cache.CurrentBytes);
+			Assert.NotEqual(IntPtr.Zero, image.Handle);
+
+			using var pixmap = image.PeekPixels();
+			Assert.NotEqual(SKColor.Empty, pixmap.GetPixelColor(32, 32));
+
+			cached.Dispose();
+			Assert.Equal(IntPtr.Zero, image.Handle);
+		}
+
+		[SkippableFact]
+		public void ConcurrentRequestsAreDecodedOnce()
+		{
+			var path = Path.Combine(PathToImages, "baboon.jpg");
+			using var cache = new SKImageCache();
+			using var start = new ManualResetEventSlim();
+
+			var decodes = 0;
+			SKData Factory()
+			{
+				Interlocked.Increment(ref decodes);
+				start.Wait();
+				return SKData.Create(path);
+			}
+
+			var tasks = Enumerable.Range(0, 8)
+				.Select(_ => Task.Run(() =>
+				{
+					using var cached = cache.GetImage("baboon", Factory, new SKSizeI(100, 100));
+					return cached.Image.Width;
+				}))
+				.ToArray();
+
+			Thread.Sleep(100);
+			start.Set();
+			Task.WaitAll(tasks);
+
+			Assert.Equal(1, decodes);
+			Assert.All(tasks, t => Assert.Equal(128, t.Result));
+			Assert.Equal(1, cache.MissCount);
+			Assert.Equal(7, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void InvalidDataIsNotCached()
+		{
+			using var cache = new SKImageCache();
+
+			var cached = cache.GetImage("invalid", () => SKData.CreateCopy(new byte[] { 1, 2, 3 }));
+
+			Assert.Null(cached);
+			Assert.Equal(0, cache.Count);
+			Assert.Equal(0, cache.CurrentBytes);
+		}
+
+		[SkippableFact]
+		public void CanRemoveAllBucketsForSource()
+		{
+			var path = Path.Combine(PathToImages, "baboon.jpg");
+			using var cache = new SKImageCache();
+
+			cache.GetImage(path, new SKSizeI(64, 64)).Dispose();
+			cache.GetImage(path, new SKSizeI(128, 128)).Dispose();
+
+			Assert.Equal(2, cache.Remove(path));
+			Assert.Equal(0, cache.Count);
+			Assert.Equal(0, cache.CurrentBytes);
+		}
+	}
+}
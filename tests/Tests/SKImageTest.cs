@@ -1,6 +1,7 @@
 ﻿using System;
 using System.IO;
 using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using Xunit;
 
 namespace SkiaSharp.Tests
@@ -956,5 +957,20 @@ namespace SkiaSharp.Tests
 
 			Assert.Equal((SKColor)color, pixmap.GetPixelColor(x, y));
 		}
+
+		[SkippableFact]
+		public async Task FromEncodedDataAsyncMatchesFromEncodedData()
+		{
+			var path = Path.Combine(PathToImages, "baboon.png");
+
+			using var stream = new ThrottledStream(File.ReadAllBytes(path), 4096);
+			using var image = await SKImage.FromEncodedDataAsync(stream);
+			using var expected = SKImage.FromEncodedData(path);
+
+			Assert.Equal(expected.Info, image.Info);
+			using var actualBitmap = SKBitmap.FromImage(image);
+			using var expectedBitmap = SKBitmap.FromImage(expected);
+			Assert.Equal(expectedBitmap.Pixels, actualBitmap.Pixels);
+		}
 	}
 }
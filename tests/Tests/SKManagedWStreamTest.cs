@@ -108,6 +108,111 @@ namespace SkiaSharp.Tests
 			Assert.Equal(data, dotnet.ToArray());
 		}
 
+		[SkippableFact]
+		public void BufferedStreamCoalescesSmallWrites()
+		{
+			var dotnet = new MemoryStream();
+			var stream = new SKManagedWStream(dotnet, false, 16);
+
+			for (var i = 0; i < 10; i++)
+				stream.Write8((byte)i);
+
+			Assert.Equal(0, dotnet.Length);
+			Assert.Equal(10, stream.BytesWritten);
+			Assert.Equal(10, stream.WriteCallbackCount);
+			Assert.Equal(0, stream.StreamWriteCount);
+
+			for (var i = 10; i < 20; i++)
+				stream.Write8((byte)i);
+
+			Assert.Equal(16, dotnet.Length);
+			Assert.Equal(20, stream.BytesWritten);
+			Assert.Equal(1, stream.StreamWriteCount);
+
+			stream.Flush();
+
+			Assert.Equal(20, dotnet.Length);
+			Assert.Equal(2, stream.StreamWriteCount);
+
+			var expected = new byte[20];
+			for (var i = 0; i < expected.Length; i++)
+				expected[i] = (byte)i;
+			Assert.Equal(expected, dotnet.ToArray());
+		}
+
+		[SkippableFact]
+		public void BufferedStreamWritesLargeChunksDirectly()
+		{
+			var data = new byte[1024];
+			for (var i = 0; i < data.Length; i++)
+				data[i] = (byte)(i % byte.MaxValue);
+
+			var dotnet = new MemoryStream();
+			var stream = new SKManagedWStream(dotnet, false, 64);
+
+			stream.Write8(1);
+			stream.Write(data, data.Length);
+
+			Assert.Equal(data.Length + 1, dotnet.Length);
+			Assert.Equal(data.Length + 1, stream.BytesWritten);
+			Assert.Equal(2, stream.StreamWriteCount);
+			Assert.Equal(1, dotnet.ToArray()[0]);
+			Assert.Equal(data, dotnet.ToArray().AsSpan(1).ToArray());
+		}
+
+		[SkippableFact]
+		public void BufferedStreamIsFlushedWhenDisposed()
+		{
+			var dotnet = new MemoryStream();
+			var stream = new SKManagedWStream(dotnet, false, 1024);
+
+			stream.Write8(123);
+			stream.Write8(246);
+
+			Assert.Equal(0, dotnet.Length);
+
+			stream.Dispose();
+
+			Assert.Equal(new byte[] { 123, 246 }, dotnet.ToArray());
+		}
+
+		[SkippableFact]
+		public void BufferedStreamIsFlushedBeforeTheManagedStreamIsDisposed()
+		{
+			var dotnet = new NotifyingMemoryStream();
+			var stream = new SKManagedWStream(dotnet, true, 1024);
+
+			stream.Write8(123);
+			stream.Dispose();
+
+			Assert.Equal(new byte[] { 123 }, dotnet.ContentsWhenDisposed);
+		}
+
+		[SkippableFact]
+		public void BufferedEncodeIsTheSameAsUnbufferedEncode()
+		{
+			using var bitmap = CreateTestBitmap();
+
+			var unbuffered = new MemoryStream();
+			using (var stream = new SKManagedWStream(unbuffered))
+				Assert.True(bitmap.Encode(stream, SKEncodedImageFormat.Png, 100));
+
+			var buffered = new MemoryStream();
+			using (var stream = new SKManagedWStream(buffered, false, SKManagedWStream.DefaultBufferSize))
+			{
+				Assert.True(bitmap.Encode(stream, SKEncodedImageFormat.Png, 100));
+				Assert.True(stream.StreamWriteCount < stream.WriteCallbackCount);
+			}
+
+			Assert.Equal(unbuffered.ToArray(), buffered.ToArray());
+		}
+
+		[SkippableFact]
+		public void NegativeBufferSizeThrows()
+		{
+			Assert.Throws<ArgumentOutOfRangeException>(() => new SKManagedWStream(new MemoryStream(), false, -1));
+		}
+
 		[SkippableFact]
 		public unsafe void StreamIsReferencedAndNotDisposedPrematurely()
 		{
@@ -148,5 +253,16 @@ namespace SkiaSharp.Tests
 				return SKDocument.CreatePdf(stream);
 			}
 		}
+
+		private class NotifyingMemoryStream : MemoryStream
+		{
+			public byte[] ContentsWhenDisposed { get; private set; }
+
+			protected override void Dispose(bool disposing)
+			{
+				ContentsWhenDisposed ??= ToArray();
+				base.Dispose(disposing);
+			}
+		}
 	}
 }
@@ -0,0 +1,281 @@
+﻿using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	// the counters are global, so nothing else may run at the same time
+	[CollectionDefinition(nameof(SKNativeMemoryTest), DisableParallelization = true)]
+	public class SKNativeMemoryTestCollection
+	{
+	}
+
+	[Collection(nameof(SKNativeMemoryTest))]
+	public class SKNativeMemoryTest : SKTest
+	{
+		private const long Megabyte = 1024 * 1024;
+
+		[SkippableFact]
+		public void BitmapTracksAllocatedPixels()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			using (var bitmap = new SKBitmap(1000, 1000))
+			{
+				Assert.Equal(before + bitmap.RowBytes * bitmap.Height, SKNativeMemory.OutstandingBytes);
+			}
+
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void BitmapReleasesPixelsOnReset()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			using var bitmap = new SKBitmap(1000, 1000);
+			Assert.True(SKNativeMemory.OutstandingBytes > before);
+
+			bitmap.Reset();
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void BitmapReallocationReplacesPixels()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			using var bitmap = new SKBitmap(1000, 1000);
+			Assert.True(bitmap.TryAllocPixels(new SKImageInfo(100, 100)));
+
+			Assert.Equal(before + 100 * 100 * 4, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void BitmapWithInstalledPixelsIsNotTracked()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			var info = new SKImageInfo(100, 100);
+			var pixels = new byte[info.BytesSize];
+			var handle = GCHandle.Alloc(pixels, GCHandleType.Pinned);
+			try
+			{
+				using var bitmap = new SKBitmap(info);
+				Assert.True(SKNativeMemory.OutstandingBytes > before);
+
+				Assert.True(bitmap.InstallPixels(info, handle.AddrOfPinnedObject()));
+				Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+			}
+			finally
+			{
+				handle.Free();
+			}
+		}
+
+		[SkippableFact]
+		public void SurfaceTracksAllocatedPixels()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			var info = new SKImageInfo(500, 500);
+			using (var surface = SKSurface.Create(info))
+			{
+				Assert.Equal(before + info.BytesSize64, SKNativeMemory.OutstandingBytes);
+			}
+
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void ImageTracksCopiedPixels()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			var info = new SKImageInfo(500, 500);
+			using (var image = SKImage.FromPixelCopy(info, new byte[info.BytesSize]))
+			{
+				// the copy is held by the image even though the data is gone
+				Assert.Equal(before + info.BytesSize64, SKNativeMemory.OutstandingBytes);
+			}
+
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void DataTracksCopiedBytes()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			using (var data = SKData.CreateCopy(new byte[12345]))
+			{
+				Assert.Equal(before + 12345, SKNativeMemory.OutstandingBytes);
+			}
+
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void DataWithExternalBytesIsNotTracked()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			var bytes = new byte[12345];
+			var handle = GCHandle.Alloc(bytes, GCHandleType.Pinned);
+			try
+			{
+				using var data = SKData.Create(handle.AddrOfPinnedObject(), bytes.Length);
+				Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+			}
+			finally
+			{
+				handle.Free();
+			}
+		}
+
+		[SkippableFact]
+		public void FinalizerReleasesTrackedBytes()
+		{
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+
+			LeakBitmap(1000, 1000);
+			Assert.True(SKNativeMemory.OutstandingBytes > before);
+
+			CollectGarbage();
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[SkippableFact]
+		public void PressureIsReportedInBatches()
+		{
+			CollectGarbage();
+
+			using (var small = new SKBitmap(10, 10))
+			{
+				Assert.True(Math.Abs(SKNativeMemory.OutstandingBytes - SKNativeMemory.ReportedBytes) < SKNativeMemory.PressureBatchBytes);
+			}
+
+			using (var large = new SKBitmap(2000, 2000))
+			{
+				Assert.True(Math.Abs(SKNativeMemory.OutstandingBytes - SKNativeMemory.ReportedBytes) < SKNativeMemory.PressureBatchBytes);
+			}
+
+			Assert.True(Math.Abs(SKNativeMemory.OutstandingBytes - SKNativeMemory.ReportedBytes) < SKNativeMemory.PressureBatchBytes);
+		}
+
+		[SkippableFact]
+		public void DisablingPressureReportingRemovesThePressure()
+		{
+			using var bitmap = new SKBitmap(2000, 2000);
+
+			try
+			{
+				SKNativeMemory.IsPressureReportingEnabled = false;
+				Assert.Equal(0, SKNativeMemory.ReportedBytes);
+
+				SKNativeMemory.IsPressureReportingEnabled = true;
+				Assert.True(SKNativeMemory.ReportedBytes > 0);
+			}
+			finally
+			{
+				SKNativeMemory.IsPressureReportingEnabled = true;
+			}
+		}
+
+		[SkippableFact]
+		public void SoftLimitMustNotBeNegative()
+		{
+			Assert.Throws<ArgumentOutOfRangeException>(() => SKNativeMemory.SoftLimit = -1);
+		}
+
+		[SkippableFact]
+		public void SoftLimitForcesCollection()
+		{
+			var oldLimit = SKNativeMemory.SoftLimit;
+			SKNativeMemory.ResetStatistics();
+			SKNativeMemory.SoftLimit = Megabyte;
+			try
+			{
+				using var bitmap = new SKBitmap(1000, 1000);
+				Assert.Equal(1, SKNativeMemory.CollectionCount);
+
+				// small allocations do not collect every time
+				using var small = new SKBitmap(10, 10);
+				Assert.Equal(1, SKNativeMemory.CollectionCount);
+			}
+			finally
+			{
+				SKNativeMemory.SoftLimit = oldLimit;
+				SKNativeMemory.ResetStatistics();
+			}
+		}
+
+		[SkippableFact]
+		public void LeakedBitmapsStayBoundedWithSoftLimit()
+		{
+			const int BitmapSize = 1024;
+			const int LeakCount = 256;
+			const long SoftLimit = 64 * Megabyte;
+
+			// 4 MB each, so 1 GB is leaked in total
+			var bitmapBytes = (long)BitmapSize * BitmapSize * 4;
+
+			CollectGarbage();
+			var before = SKNativeMemory.OutstandingBytes;
+			var process = Process.GetCurrentProcess();
+			process.Refresh();
+			var workingSetBefore = process.WorkingSet64;
+
+			var oldLimit = SKNativeMemory.SoftLimit;
+			SKNativeMemory.ResetStatistics();
+			SKNativeMemory.SoftLimit = SoftLimit;
+			try
+			{
+				var peakBytes = 0L;
+				var peakWorkingSet = 0L;
+				for (var i = 0; i < LeakCount; i++)
+				{
+					// touch the pixels so that they are really resident
+					LeakBitmap(BitmapSize, BitmapSize, SKColors.Red);
+
+					peakBytes = Math.Max(peakBytes, SKNativeMemory.OutstandingBytes - before);
+					if (i % 16 == 0)
+					{
+						process.Refresh();
+						peakWorkingSet = Math.Max(peakWorkingSet, process.WorkingSet64 - workingSetBefore);
+					}
+				}
+
+				var leaked = LeakCount * bitmapBytes;
+				Assert.True(peakBytes < leaked / 2, $"Peak of {peakBytes / Megabyte} MB of {leaked / Megabyte} MB leaked.");
+				Assert.True(peakWorkingSet < leaked / 2, $"Working set grew by {peakWorkingSet / Megabyte} MB of {leaked / Megabyte} MB leaked.");
+			}
+			finally
+			{
+				SKNativeMemory.SoftLimit = oldLimit;
+				CollectGarbage();
+			}
+
+			Assert.Equal(before, SKNativeMemory.OutstandingBytes);
+		}
+
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		private static void LeakBitmap(int width, int height, SKColor? color = null)
+		{
+			var bitmap = new SKBitmap(width, height);
+			if (color is SKColor c)
+				bitmap.Erase(c);
+		}
+	}
+}
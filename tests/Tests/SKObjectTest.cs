@@ -521,6 +521,188 @@ namespace SkiaSharp.Tests
 			nativeParent.Dispose();
 		}
 
+		[SkippableFact]
+		public void ObjectsWithoutChildrenHaveNoOwnedObjects()
+		{
+			using var parent = TrackedObject.Create("parent", null);
+
+			Assert.Empty(parent.GetOwnedObjects());
+			Assert.Empty(parent.GetKeepAliveObjects());
+		}
+
+		[SkippableFact]
+		public void SingleOwnedChildIsDisposedWithOwner()
+		{
+			var log = new ConcurrentQueue<string>();
+
+			var parent = TrackedObject.Create("parent", log);
+			var child = SKObject.OwnedBy(TrackedObject.Create("child", log), parent);
+
+			Assert.Same(child, Assert.Single(parent.GetOwnedObjects()));
+
+			parent.Dispose();
+
+			Assert.True(child.IsDisposed);
+			Assert.Empty(parent.GetOwnedObjects());
+			Assert.Equal(new[] { "parent", "child" }, log);
+		}
+
+		[SkippableFact]
+		public void ManyOwnedChildrenAreDisposedInOrderWithOwner()
+		{
+			var log = new ConcurrentQueue<string>();
+
+			var parent = TrackedObject.Create("parent", log);
+			var children = Enumerable.Range(0, 5)
+				.Select(i => SKObject.OwnedBy(TrackedObject.Create($"child{i}", log), parent))
+				.ToArray();
+
+			Assert.Equal(children, parent.GetOwnedObjects());
+
+			parent.Dispose();
+
+			Assert.All(children, c => Assert.True(c.IsDisposed));
+			Assert.Empty(parent.GetOwnedObjects());
+			Assert.Equal(new[] { "parent" }.Concat(children.Select(c => c.Name)), log);
+		}
+
+		[SkippableFact]
+		public void UnownedChildrenAreDisposedBeforeOwner()
+		{
+			var log = new ConcurrentQueue<string>();
+
+			var parent = TrackedObject.Create("parent", log);
+			var owned = SKObject.OwnedBy(TrackedObject.Create("owned", log), parent);
+			var unowned = SKObject.OwnedBy(TrackedObject.Create("unowned", log, false), parent);
+
+			parent.Dispose();
+
+			Assert.True(owned.IsDisposed);
+			Assert.True(unowned.IsDisposed);
+			Assert.Equal(new[] { "unowned", "parent", "owned" }, log);
+		}
+
+		[SkippableFact]
+		public void OwningTheSameHandleReplacesTheChild()
+		{
+			var log = new ConcurrentQueue<string>();
+
+			// the wrappers share handles, so they must not be registered
+			var parent = TrackedObject.Create("parent", log);
+			var first = UnregisteredObject.Create("first", log);
+			var second = new UnregisteredObject("second", log, first.Handle, true);
+
+			SKObject.OwnedBy(first, parent);
+			SKObject.OwnedBy(second, parent);
+			SKObject.OwnedBy(second, parent);
+
+			Assert.Same(second, Assert.Single(parent.GetOwnedObjects()));
+
+			// the replacement keeps the place of the child that it replaced
+			var third = SKObject.OwnedBy(UnregisteredObject.Create("third", log), parent);
+			var fourth = SKObject.OwnedBy(UnregisteredObject.Create("fourth", log), parent);
+			var fifth = new UnregisteredObject("fifth", log, third.Handle, true);
+			SKObject.OwnedBy(fifth, parent);
+
+			Assert.Equal(new SKObject[] { second, fifth, fourth }, parent.GetOwnedObjects());
+
+			parent.Dispose();
+
+			Assert.False(first.IsDisposed);
+			Assert.True(second.IsDisposed);
+			Assert.False(third.IsDisposed);
+			Assert.True(fourth.IsDisposed);
+			Assert.True(fifth.IsDisposed);
+			Assert.Equal(new[] { "parent", "second", "fifth", "fourth" }, log);
+
+			first.Dispose();
+			third.Dispose();
+		}
+
+		[SkippableFact]
+		public void KeepAliveObjectsAreReleasedButNotDisposed()
+		{
+			var parent = TrackedObject.Create("parent", null);
+			var first = TrackedObject.Create("first", null);
+			var second = TrackedObject.Create("second", null);
+
+			SKObject.Referenced(parent, first);
+			SKObject.Referenced(parent, second);
+
+			Assert.Equal(new[] { first, second }, parent.GetKeepAliveObjects());
+
+			parent.Dispose();
+
+			Assert.Empty(parent.GetKeepAliveObjects());
+			Assert.False(first.IsDisposed);
+			Assert.False(second.IsDisposed);
+
+			first.Dispose();
+			second.Dispose();
+		}
+
+		[SkippableFact]
+		public void OwnedChildrenCanBeAddedConcurrently()
+		{
+			var parent = TrackedObject.Create("parent", null);
+
+			var children = new ConcurrentBag<TrackedObject>();
+			Parallel.For(0, 1000, i =>
+			{
+				var child = SKObject.OwnedBy(TrackedObject.Create($"child{i}", null), parent);
+				children.Add(child);
+			});
+
+			Assert.Equal(1000, parent.GetOwnedObjects().Length);
+
+			parent.Dispose();
+
+			Assert.All(children, c => Assert.True(c.IsDisposed));
+		}
+
+		private class TrackedObject : SKObject
+		{
+			private readonly ConcurrentQueue<string> log;
+
+			public TrackedObject(string name, ConcurrentQueue<string> log, IntPtr handle, bool owns)
+				: base(handle, owns)
+			{
+				Name = name;
+				this.log = log;
+			}
+
+			public string Name { get; }
+
+			public static TrackedObject Create(string name, ConcurrentQueue<string> log, bool owns = true) =>
+				new TrackedObject(name, log, GetNextPtr(), owns);
+
+			protected override void DisposeNative() =>
+				log?.Enqueue(Name);
+
+			protected override void DisposeManaged()
+			{
+				// there is no native object, so log the managed disposal
+				if (!OwnsHandle)
+					log?.Enqueue(Name);
+
+				base.DisposeManaged();
+			}
+
+			public override string ToString() =>
+				$"Tracked: {Name}";
+		}
+
+		private class UnregisteredObject : TrackedObject, ISKSkipObjectRegistration
+		{
+			public UnregisteredObject(string name, ConcurrentQueue<string> log, IntPtr handle, bool owns)
+				: base(name, log, handle, owns)
+			{
+			}
+
+			public static new UnregisteredObject Create(string name, ConcurrentQueue<string> log, bool owns = true) =>
+				new UnregisteredObject(name, log, GetNextPtr(), owns);
+		}
+
 		private static class ParentChildWorld
 		{
 			public static readonly IntPtr ParentHandle = GetNextPtr();
@@ -0,0 +1,75 @@
+﻿using System;
+using System.IO;
+using System.Text;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKParallelDocumentBuilderTest : SKTest
+	{
+		[SkippableFact]
+		public void CanCreatePdfWithManyPages()
+		{
+			using var stream = new MemoryStream();
+
+			using (var doc = SKDocument.CreatePdf(stream))
+			using (var builder = new SKParallelDocumentBuilder(doc, 4, 8))
+			{
+				for (var i = 0; i < 50; i++)
+				{
+					var page = i;
+					builder.AddPage(200, 200, canvas =>
+					{
+						using var paint = new SKPaint { Color = SKColors.Red };
+						canvas.DrawRect(page, page, 50, 50, paint);
+					});
+				}
+
+				builder.Close();
+
+				Assert.Equal(50, builder.PageCount);
+				Assert.Equal(50, builder.WrittenPageCount);
+				Assert.InRange(builder.PeakPendingPages, 1, 8);
+			}
+
+			var pdf = Encoding.ASCII.GetString(stream.ToArray());
+			Assert.Contains("/Count 50", pdf);
+		}
+
+		[SkippableFact]
+		public void PagesAreWrittenBeforeTheDocumentIsClosed()
+		{
+			using var stream = new MemoryStream();
+			using var doc = SKDocument.CreatePdf(stream);
+			using var builder = new SKParallelDocumentBuilder(doc, 2, 2);
+
+			for (var i = 0; i < 10; i++)
+				builder.AddPage(100, 100, canvas => canvas.Clear(SKColors.Blue));
+
+			Assert.True(builder.WrittenPageCount >= 8);
+
+			builder.Close();
+		}
+
+		[SkippableFact]
+		public void ExceptionsInPageDrawingAreRethrown()
+		{
+			using var stream = new MemoryStream();
+			using var doc = SKDocument.CreatePdf(stream);
+			using var builder = new SKParallelDocumentBuilder(doc, 2);
+
+			builder.AddPage(100, 100, canvas => throw new InvalidOperationException("page"));
+
+			Assert.Throws<InvalidOperationException>(() => builder.Flush());
+		}
+
+		[SkippableFact]
+		public void PendingPagesMustNotBeLessThanParallelism()
+		{
+			using var stream = new MemoryStream();
+			using var doc = SKDocument.CreatePdf(stream);
+
+			Assert.Throws<ArgumentOutOfRangeException>(() => new SKParallelDocumentBuilder(doc, 4, 2));
+		}
+	}
+}
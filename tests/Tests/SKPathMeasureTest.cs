@@ -26,5 +26,140 @@ namespace SkiaSharp.Tests
 			var pm = new SKPathMeasure();
 			Assert.NotNull(pm);
 		}
+
+		[SkippableFact]
+		public void BatchPositionsAndTangentsMatchSingleSamples()
+		{
+			using var path = CreateRoute();
+			using var measure = new SKPathMeasure(path);
+
+			var distances = new[] { 0f, 12.5f, 40f, 99f, measure.Length, measure.Length + 10 };
+			var positions = new SKPoint[distances.Length];
+			var tangents = new SKPoint[distances.Length];
+
+			Assert.True(measure.GetPositionsAndTangents(distances, positions, tangents));
+
+			for (var i = 0; i < distances.Length; i++)
+			{
+				Assert.True(measure.GetPositionAndTangent(distances[i], out var position, out var tangent));
+				Assert.Equal(position, positions[i]);
+				Assert.Equal(tangent, tangents[i]);
+			}
+		}
+
+		[SkippableFact]
+		public void BatchWithStepMatchesSingleSamples()
+		{
+			using var path = CreateRoute();
+			using var measure = new SKPathMeasure(path);
+
+			var positions = new SKPoint[20];
+
+			Assert.True(measure.GetPositionsAndTangents(5, 7.5f, positions.Length, positions, Span<SKPoint>.Empty));
+
+			for (var i = 0; i < positions.Length; i++)
+				Assert.Equal(measure.GetPosition(5 + 7.5f * i), positions[i]);
+		}
+
+		[SkippableFact]
+		public void BatchMatricesMatchSingleSamples()
+		{
+			using var path = CreateRoute();
+			using var measure = new SKPathMeasure(path);
+
+			var flags = SKPathMeasureMatrixFlags.GetPositionAndTangent;
+			var matrices = new SKMatrix[10];
+
+			Assert.True(measure.GetMatrices(0, 10, matrices.Length, matrices, flags));
+
+			for (var i = 0; i < matrices.Length; i++)
+				Assert.Equal(measure.GetMatrix(10 * i, flags), matrices[i]);
+		}
+
+		[SkippableFact]
+		public void BatchThrowsWhenSpanIsTooShort()
+		{
+			using var path = CreateRoute();
+			using var measure = new SKPathMeasure(path);
+
+			var distances = new float[10];
+
+			Assert.Throws<ArgumentException>(() => measure.GetPositionsAndTangents(distances, new SKPoint[5], null));
+			Assert.Throws<ArgumentException>(() => measure.GetMatrices(distances, new SKMatrix[5], SKPathMeasureMatrixFlags.GetPosition));
+		}
+
+		[SkippableFact]
+		public void BatchOnEmptyPathFails()
+		{
+			using var path = new SKPath();
+			using var measure = new SKPathMeasure(path);
+
+			var positions = new SKPoint[3];
+
+			Assert.False(measure.GetPositionsAndTangents(new[] { 0f, 1f, 2f }, positions, null));
+			Assert.False(SKPathMeasure.GetPositionsAndTangents(path, new[] { 0f, 1f, 2f }, positions, null));
+		}
+
+		[SkippableFact]
+		public void PathSamplesContinueThroughAllContours()
+		{
+			using var path = new SKPath();
+			path.MoveTo(0, 0);
+			path.LineTo(100, 0);
+			path.MoveTo(0, 50);
+			path.LineTo(0, 100);
+
+			Assert.Equal(150, SKPathMeasure.GetTotalLength(path));
+
+			// the distances do not have to be in order
+			var distances = new[] { 120f, 10f, 100f, 149f, 50f };
+			var positions = new SKPoint[distances.Length];
+			var tangents = new SKPoint[distances.Length];
+
+			Assert.True(SKPathMeasure.GetPositionsAndTangents(path, distances, positions, tangents));
+
+			Assert.Equal(new SKPoint(0, 70), positions[0]);
+			Assert.Equal(new SKPoint(0, 1), tangents[0]);
+			Assert.Equal(new SKPoint(10, 0), positions[1]);
+			Assert.Equal(new SKPoint(1, 0), tangents[1]);
+			Assert.Equal(new SKPoint(0, 50), positions[2]);
+			Assert.Equal(new SKPoint(0, 99), positions[3]);
+			Assert.Equal(new SKPoint(50, 0), positions[4]);
+		}
+
+		[SkippableTheory]
+		[InlineData(100, 10, 0, 11)]
+		[InlineData(100, 30, 0, 4)]
+		[InlineData(100, 30, 15, 3)]
+		[InlineData(100, 200, 0, 1)]
+		[InlineData(100, 10, 150, 0)]
+		public void EvenlySpacedDistancesCoverTheLength(float length, float spacing, float offset, int count)
+		{
+			var distances = new float[20];
+
+			Assert.Equal(count, SKPathMeasure.GetEvenlySpacedDistances(length, spacing, offset, distances));
+
+			for (var i = 0; i < count; i++)
+				Assert.Equal(offset + spacing * i, distances[i]);
+		}
+
+		[SkippableFact]
+		public void EvenlySpacedDistancesReturnsTheNeededCount()
+		{
+			var distances = new float[5];
+
+			Assert.Equal(101, SKPathMeasure.GetEvenlySpacedDistances(100, 1, 0, distances));
+			Assert.Equal(new[] { 0f, 1f, 2f, 3f, 4f }, distances);
+		}
+
+		private static SKPath CreateRoute()
+		{
+			var path = new SKPath();
+			path.MoveTo(10, 10);
+			path.LineTo(60, 10);
+			path.QuadTo(90, 10, 90, 40);
+			path.CubicTo(90, 80, 40, 60, 20, 90);
+			return path;
+		}
 	}
 }
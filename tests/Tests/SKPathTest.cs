@@ -507,5 +507,171 @@ namespace SkiaSharp.Tests
 			Assert.NotEqual(path, result);
 			Assert.Equal(SKPathFillType.Winding, result.FillType);
 		}
+
+		[SkippableFact]
+		public void UnionOfNoPathsIsEmpty()
+		{
+			using var result = SKPath.Union(new SKPath[0]);
+
+			Assert.NotNull(result);
+			Assert.True(result.IsEmpty);
+		}
+
+		[SkippableFact]
+		public void UnionWithNullPathThrows()
+		{
+			using var path = new SKPath();
+			path.AddRect(SKRect.Create(10, 10));
+
+			Assert.Throws<ArgumentException>(() => SKPath.Union(new[] { path, null }));
+		}
+
+		[SkippableTheory]
+		[InlineData(1, 1)]
+		[InlineData(10, 1)]
+		[InlineData(500, 1)]
+		[InlineData(500, 4)]
+		public void UnionMatchesOpBuilder(int count, int maxDegreeOfParallelism)
+		{
+			var paths = CreateFootprints(count, 7);
+			try
+			{
+				using var expected = ResolveSerially(paths, SKPathOp.Union);
+				using var actual = SKPath.Union(paths, maxDegreeOfParallelism);
+
+				Assert.NotNull(actual);
+				AssertSameFill(expected, actual);
+			}
+			finally
+			{
+				foreach (var path in paths)
+					path.Dispose();
+			}
+		}
+
+		[SkippableTheory]
+		[InlineData(100, 1)]
+		[InlineData(100, 4)]
+		public void IntersectMatchesOpBuilder(int count, int maxDegreeOfParallelism)
+		{
+			var random = new Random(3);
+			var paths = new SKPath[count];
+			for (var i = 0; i < count; i++)
+			{
+				paths[i] = new SKPath();
+				paths[i].AddCircle(200 + random.Next(-40, 40), 200 + random.Next(-40, 40), 120 + random.Next(40));
+			}
+
+			try
+			{
+				using var expected = ResolveSerially(paths, SKPathOp.Intersect);
+				using var actual = SKPath.Intersect(paths, maxDegreeOfParallelism);
+
+				Assert.NotNull(actual);
+				Assert.False(actual.IsEmpty);
+				AssertSameFill(expected, actual);
+			}
+			finally
+			{
+				foreach (var path in paths)
+					path.Dispose();
+			}
+		}
+
+		[SkippableFact]
+		public void IntersectOfDisjointPathsIsEmpty()
+		{
+			using var first = new SKPath();
+			first.AddRect(SKRect.Create(0, 0, 10, 10));
+			using var second = new SKPath();
+			second.AddRect(SKRect.Create(20, 20, 10, 10));
+
+			using var result = SKPath.Intersect(new[] { first, second });
+
+			Assert.NotNull(result);
+			Assert.True(result.IsEmpty);
+		}
+
+		[SkippableFact]
+		public void SpatialOrderKeepsNearbyPathsTogether()
+		{
+			var bounds = new[]
+			{
+				SKRect.Create(0, 0, 1, 1),
+				SKRect.Create(90, 90, 1, 1),
+				SKRect.Create(1, 1, 1, 1),
+				SKRect.Create(91, 91, 1, 1),
+			};
+
+			var order = SKPathCombiner.GetSpatialOrder(bounds, SKRect.Create(0, 0, 92, 92));
+
+			Assert.Equal(new[] { 0, 2, 1, 3 }, order);
+		}
+
+		private static SKPath[] CreateFootprints(int count, int seed)
+		{
+			// rotated rectangles in a grid, where the neighbours overlap
+			var random = new Random(seed);
+			var columns = (int)Math.Ceiling(Math.Sqrt(count));
+			var paths = new SKPath[count];
+			for (var i = 0; i < count; i++)
+			{
+				var path = new SKPath();
+				path.AddRect(SKRect.Create(-12, -8, 24 + random.Next(12), 16 + random.Next(12)));
+				var matrix = SKMatrix.CreateRotationDegrees(random.Next(90))
+					.PostConcat(SKMatrix.CreateTranslation((i % columns) * 20 + 20, (i / columns) * 20 + 20));
+				path.Transform(matrix);
+				paths[i] = path;
+			}
+			return paths;
+		}
+
+		private static SKPath ResolveSerially(SKPath[] paths, SKPathOp op)
+		{
+			using var builder = new SKPath.OpBuilder();
+			for (var i = 0; i < paths.Length; i++)
+				builder.Add(paths[i], i == 0 ? SKPathOp.Union : op);
+
+			var result = new SKPath();
+			Assert.True(builder.Resolve(result));
+			return result;
+		}
+
+		private static void AssertSameFill(SKPath expected, SKPath actual)
+		{
+			// the two results may have the contours in a different order, so
+			// compare what they fill instead
+			var bounds = expected.Bounds;
+			bounds.Union(actual.Bounds);
+			var info = new SKImageInfo((int)Math.Ceiling(bounds.Right) + 1, (int)Math.Ceiling(bounds.Bottom) + 1, SKColorType.Gray8);
+
+			using var expectedBitmap = Rasterize(expected, info);
+			using var actualBitmap = Rasterize(actual, info);
+
+			var expectedBytes = expectedBitmap.Bytes;
+			var actualBytes = actualBitmap.Bytes;
+
+			var different = 0;
+			for (var i = 0; i < expectedBytes.Length; i++)
+			{
+				if (expectedBytes[i] != actualBytes[i])
+					different++;
+			}
+
+			// allow for the odd pixel on an edge that moved very slightly
+			Assert.True(different <= expectedBytes.Length / 1000, $"{different} pixels are different.");
+		}
+
+		private static SKBitmap Rasterize(SKPath path, SKImageInfo info)
+		{
+			var bitmap = new SKBitmap(info);
+			using var canvas = new SKCanvas(bitmap);
+			using var paint = new SKPaint { Color = SKColors.White };
+
+			canvas.Clear(SKColors.Black);
+			canvas.DrawPath(path, paint);
+
+			return bitmap;
+		}
 	}
 }
@@ -0,0 +1,379 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKPictureCacheTest : SKTest, IDisposable
+	{
+		private readonly string directory;
+
+		public SKPictureCacheTest()
+		{
+			directory = Path.Combine(PathToAssembly, "picture-cache-" + Guid.NewGuid().ToString("N"));
+		}
+
+		public void Dispose()
+		{
+			if (Directory.Exists(directory))
+				Directory.Delete(directory, true);
+		}
+
+		private static SKPicture CreatePicture(int seed, int rects = 100)
+		{
+			var random = new Random(seed);
+
+			using var recorder = new SKPictureRecorder();
+			var canvas = recorder.BeginRecording(SKRect.Create(100, 100));
+
+			using var paint = new SKPaint();
+			for (var i = 0; i < rects; i++)
+			{
+				paint.Color = new SKColor((uint)random.Next() | 0xFF000000);
+				canvas.DrawRect(random.Next(100), random.Next(100), random.Next(1, 50), random.Next(1, 50), paint);
+			}
+
+			return recorder.EndRecording();
+		}
+
+		private static byte[] Render(SKPicture picture)
+		{
+			using var bitmap = new SKBitmap(100, 100);
+			using (var canvas = new SKCanvas(bitmap))
+			{
+				canvas.Clear(SKColors.Transparent);
+				canvas.DrawPicture(picture);
+			}
+			return bitmap.Bytes;
+		}
+
+		// adds pictures until a new segment is started, and returns its path
+		private static string FillUntilTheNextSegment(SKPictureCache cache, List<SKPictureCacheKey> keys)
+		{
+			var segments = Directory.GetFiles(cache.Directory, "*.skpc");
+			while (true)
+			{
+				Assert.True(keys.Count < 1000);
+
+				var key = SKPictureCacheKey.FromString("filler" + keys.Count);
+				Assert.True(cache.Add(key, CreatePicture(1000 + keys.Count)));
+				keys.Add(key);
+
+				var added = Directory.GetFiles(cache.Directory, "*.skpc").Except(segments).ToArray();
+				if (added.Length > 0)
+					return added.Single();
+			}
+		}
+
+		[SkippableFact]
+		public void KeyIsMurmurHash3()
+		{
+			Assert.Equal("00000000000000000000000000000000", SKPictureCacheKey.FromString("").ToString());
+			Assert.Equal("e34bbc7bbc071b6c7a433ca9c49a9347", SKPictureCacheKey.FromString("The quick brown fox jumps over the lazy dog").ToString());
+		}
+
+		[SkippableFact]
+		public void KeysForTheSameContentAreEqual()
+		{
+			var bytes = Enumerable.Range(0, 37).Select(i => (byte)i).ToArray();
+
+			Assert.Equal(SKPictureCacheKey.FromContent(bytes), SKPictureCacheKey.FromContent(bytes.ToArray()));
+			Assert.True(SKPictureCacheKey.FromString("tile/1/2/3") == SKPictureCacheKey.FromString("tile/1/2/3"));
+			Assert.True(SKPictureCacheKey.FromString("tile/1/2/3") != SKPictureCacheKey.FromString("tile/1/2/4"));
+		}
+
+		[SkippableFact]
+		public void CachedPictureDrawsTheSame()
+		{
+			var key = SKPictureCacheKey.FromString("picture");
+			using var cache = new SKPictureCache(directory);
+			using var picture = CreatePicture(1);
+
+			Assert.True(cache.Add(key, picture));
+			using var cached = cache.GetPicture(key);
+
+			Assert.NotNull(cached);
+			Assert.Equal(picture.CullRect, cached.CullRect);
+			Assert.Equal(Render(picture), Render(cached));
+			Assert.Equal(1, cache.Count);
+			Assert.Equal(1, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void MissingPictureIsNull()
+		{
+			using var cache = new SKPictureCache(directory);
+
+			Assert.Null(cache.GetPicture(SKPictureCacheKey.FromString("missing")));
+			Assert.Equal(1, cache.MissCount);
+		}
+
+		[SkippableFact]
+		public void RecorderIsOnlyUsedOnce()
+		{
+			var key = SKPictureCacheKey.FromString("picture");
+			using var cache = new SKPictureCache(directory);
+
+			var recorded = 0;
+			SKPicture Record()
+			{
+				recorded++;
+				return CreatePicture(1);
+			}
+
+			using (var first = cache.GetPicture(key, Record))
+				Assert.NotNull(first);
+			using (var second = cache.GetPicture(key, Record))
+				Assert.NotNull(second);
+
+			Assert.Equal(1, recorded);
+		}
+
+		[SkippableFact]
+		public void PicturesSurviveReopening()
+		{
+			using var picture = CreatePicture(1);
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				for (var i = 0; i < 10; i++)
+					cache.Add(SKPictureCacheKey.FromString("picture" + i), CreatePicture(i));
+			}
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				Assert.Equal(10, cache.Count);
+
+				using var cached = cache.GetPicture(SKPictureCacheKey.FromString("picture1"));
+				Assert.NotNull(cached);
+				Assert.Equal(Render(picture), Render(cached));
+			}
+		}
+
+		[SkippableFact]
+		public void RemovedPicturesStayRemoved()
+		{
+			var key = SKPictureCacheKey.FromString("picture");
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				cache.Add(key, CreatePicture(1));
+				cache.Add(SKPictureCacheKey.FromString("other"), CreatePicture(2));
+
+				Assert.True(cache.Remove(key));
+				Assert.False(cache.Remove(key));
+			}
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				Assert.False(cache.Contains(key));
+				Assert.True(cache.Contains(SKPictureCacheKey.FromString("other")));
+			}
+		}
+
+		[SkippableFact]
+		public void RemovedPicturesStayRemovedAcrossSegments()
+		{
+			var key = SKPictureCacheKey.FromString("picture");
+			var old = SKPictureCacheKey.FromString("old");
+			var fillers = new List<SKPictureCacheKey>();
+
+			using (var cache = new SKPictureCache(directory, 1024 * 1024))
+			{
+				cache.Add(key, CreatePicture(1));
+				cache.Add(old, CreatePicture(2));
+				var first = Directory.GetFiles(directory, "*.skpc").Single();
+
+				// the tombstone goes into the second segment
+				var second = FillUntilTheNextSegment(cache, fillers);
+				Assert.True(cache.Remove(key));
+
+				// empty the second segment, while the first one still holds
+				// the removed record
+				FillUntilTheNextSegment(cache, fillers);
+				foreach (var filler in fillers.Take(fillers.Count - 1))
+					Assert.True(cache.Remove(filler));
+
+				// go over the budget so that the empty segment is deleted
+				var extra = 0;
+				while (File.Exists(second))
+				{
+					Assert.True(extra < 1000);
+
+					cache.Add(SKPictureCacheKey.FromString("extra" + extra), CreatePicture(2000 + extra));
+					cache.GetPicture(old).Dispose();
+					extra++;
+				}
+
+				Assert.True(File.Exists(first));
+				Assert.True(cache.Contains(old));
+			}
+
+			using (var cache = new SKPictureCache(directory, 1024 * 1024))
+			{
+				Assert.False(cache.Contains(key));
+				Assert.True(cache.Contains(old));
+			}
+		}
+
+		[SkippableFact]
+		public void EvictedPicturesStayEvicted()
+		{
+			const long maxBytes = 512 * 1024;
+			var keys = Enumerable.Range(0, 200).Select(i => SKPictureCacheKey.FromString("picture" + i)).ToArray();
+
+			SKPictureCacheKey[] evicted;
+			int count;
+			using (var cache = new SKPictureCache(directory, maxBytes))
+			{
+				for (var i = 0; i < keys.Length; i++)
+					cache.Add(keys[i], CreatePicture(i));
+
+				Assert.True(cache.EvictionCount > 0);
+
+				evicted = keys.Where(k => !cache.Contains(k)).ToArray();
+				count = cache.Count;
+			}
+
+			using (var cache = new SKPictureCache(directory, maxBytes))
+			{
+				Assert.Equal(count, cache.Count);
+				foreach (var key in evicted)
+					Assert.False(cache.Contains(key));
+			}
+		}
+
+		[SkippableFact]
+		public void RecentlyUsedOrderSurvivesReopening()
+		{
+			var first = SKPictureCacheKey.FromString("picture0");
+			var second = SKPictureCacheKey.FromString("picture1");
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				for (var i = 0; i < 200; i++)
+					cache.Add(SKPictureCacheKey.FromString("picture" + i), CreatePicture(i));
+
+				cache.GetPicture(first).Dispose();
+			}
+
+			// the smaller budget evicts the least recently used pictures
+			using (var cache = new SKPictureCache(directory, 512 * 1024))
+			{
+				Assert.True(cache.EvictionCount > 0);
+				Assert.True(cache.Contains(first));
+				Assert.False(cache.Contains(second));
+				Assert.True(cache.Contains(SKPictureCacheKey.FromString("picture199")));
+			}
+		}
+
+		[SkippableFact]
+		public void ReplacedPictureIsTheLatest()
+		{
+			var key = SKPictureCacheKey.FromString("picture");
+			using var latest = CreatePicture(2);
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				cache.Add(key, CreatePicture(1));
+				cache.Add(key, latest);
+				Assert.Equal(1, cache.Count);
+			}
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				using var cached = cache.GetPicture(key);
+				Assert.Equal(Render(latest), Render(cached));
+			}
+		}
+
+		[SkippableFact]
+		public void LeastRecentlyUsedPicturesAreEvicted()
+		{
+			const long maxBytes = 512 * 1024;
+			var keep = SKPictureCacheKey.FromString("keep");
+			using var cache = new SKPictureCache(directory, maxBytes);
+
+			cache.Add(keep, CreatePicture(0));
+			for (var i = 1; i < 200; i++)
+			{
+				cache.Add(SKPictureCacheKey.FromString("picture" + i), CreatePicture(i));
+				cache.GetPicture(keep).Dispose();
+
+				Assert.True(cache.CurrentBytes <= maxBytes);
+			}
+
+			Assert.True(cache.EvictionCount > 0);
+			Assert.True(cache.Contains(keep));
+			Assert.False(cache.Contains(SKPictureCacheKey.FromString("picture1")));
+			Assert.True(cache.Contains(SKPictureCacheKey.FromString("picture199")));
+		}
+
+		[SkippableFact]
+		public void ShrinkingTheBudgetTrimsTheFiles()
+		{
+			using var cache = new SKPictureCache(directory);
+			for (var i = 0; i < 100; i++)
+				cache.Add(SKPictureCacheKey.FromString("picture" + i), CreatePicture(i));
+
+			cache.MaxBytes = 256 * 1024;
+
+			Assert.True(cache.CurrentBytes <= 256 * 1024);
+			Assert.True(Directory.GetFiles(directory, "*.skpc").Sum(f => new FileInfo(f).Length) <= 256 * 1024);
+		}
+
+		[SkippableFact]
+		public void PicturesThatAreTooLargeAreNotCached()
+		{
+			using var cache = new SKPictureCache(directory, 64 * 1024);
+			using var picture = CreatePicture(1, 5000);
+
+			Assert.False(cache.Add(SKPictureCacheKey.FromString("picture"), picture));
+			Assert.Equal(0, cache.Count);
+		}
+
+		[SkippableFact]
+		public void PartlyWrittenPictureIsIgnored()
+		{
+			using (var cache = new SKPictureCache(directory))
+			{
+				cache.Add(SKPictureCacheKey.FromString("picture1"), CreatePicture(1));
+				cache.Add(SKPictureCacheKey.FromString("picture2"), CreatePicture(2));
+			}
+
+			// cut the last picture in half
+			var segment = Directory.GetFiles(directory, "*.skpc").Single();
+			using (var stream = File.Open(segment, FileMode.Open))
+				stream.SetLength(stream.Length - 100);
+
+			using (var cache = new SKPictureCache(directory))
+			{
+				Assert.True(cache.Contains(SKPictureCacheKey.FromString("picture1")));
+				Assert.False(cache.Contains(SKPictureCacheKey.FromString("picture2")));
+
+				cache.Add(SKPictureCacheKey.FromString("picture3"), CreatePicture(3));
+				using var cached = cache.GetPicture(SKPictureCacheKey.FromString("picture3"));
+				Assert.NotNull(cached);
+			}
+		}
+
+		[SkippableFact]
+		public void DirectoryCanOnlyBeUsedByOneCache()
+		{
+			using var cache = new SKPictureCache(directory);
+
+			Assert.Throws<IOException>(() => new SKPictureCache(directory));
+		}
+
+		[SkippableFact]
+		public void DisposedCacheThrows()
+		{
+			var cache = new SKPictureCache(directory);
+			cache.Dispose();
+
+			Assert.Throws<ObjectDisposedException>(() => cache.GetPicture(SKPictureCacheKey.FromString("picture")));
+		}
+	}
+}
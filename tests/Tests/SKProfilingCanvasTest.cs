@@ -0,0 +1,185 @@
+﻿using System;
+using System.IO;
+using System.Linq;
+using System.Text;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKProfilingCanvasTest : SKTest
+	{
+		[SkippableFact]
+		public void OperationsAreForwardedToTheTargetCanvas()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var paint = new SKPaint { Color = SKColors.Red };
+
+			profiling.Clear(SKColors.White);
+			profiling.DrawRect(0, 0, 5, 5, paint);
+
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(2, 2));
+			Assert.Equal(SKColors.White, bitmap.GetPixel(7, 7));
+		}
+
+		[SkippableFact]
+		public void OperationsAreCounted()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var paint = new SKPaint();
+
+			for (var i = 0; i < 3; i++)
+				profiling.DrawRect(0, 0, 5, 5, paint);
+			profiling.DrawCircle(5, 5, 2, paint);
+
+			var report = profiling.GetReport();
+
+			Assert.Equal(3, report.Operations.Single(o => o.Operation == SKCanvasOperation.DrawRect).Count);
+			Assert.Equal(1, report.Operations.Single(o => o.Operation == SKCanvasOperation.DrawCircle).Count);
+			Assert.Equal(4, report.TotalCount);
+		}
+
+		[SkippableFact]
+		public void NestedOperationsAreAttributedToTheOuterCall()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var font = new SKFont();
+			using var paint = new SKPaint();
+
+			profiling.DrawText("Hello", 10, 50, font, paint);
+
+			var report = profiling.GetReport();
+
+			Assert.Equal(SKCanvasOperation.DrawText, Assert.Single(report.Operations).Operation);
+		}
+
+		[SkippableFact]
+		public void CallsWithInvalidArgumentsAreNotCounted()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var font = new SKFont();
+			using var paint = new SKPaint();
+
+			Assert.Throws<ArgumentNullException>(() => profiling.DrawText(null, 0, 0, font, paint));
+			Assert.Throws<ArgumentNullException>(() => profiling.DrawSurface(null, 0, 0, paint));
+			Assert.Throws<ArgumentNullException>(() => profiling.DrawBitmap(null, 0, 0, paint));
+			Assert.Throws<ArgumentNullException>(() => profiling.DrawVertices(SKVertexMode.Triangles, null, null, paint));
+
+			var report = profiling.GetReport();
+
+			Assert.Empty(report.Operations);
+			Assert.Equal(0, report.TotalCount);
+		}
+
+		[SkippableFact]
+		public void PaintFeaturesAreRecorded()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var shader = SKShader.CreateColor(SKColors.Blue);
+			using var paint = new SKPaint { IsAntialias = true, Shader = shader };
+
+			profiling.DrawRect(0, 0, 5, 5, paint);
+			profiling.SaveLayer(null);
+			profiling.Restore();
+
+			var report = profiling.GetReport();
+			var rect = report.Operations.Single(o => o.Operation == SKCanvasOperation.DrawRect);
+			var layer = report.Operations.Single(o => o.Operation == SKCanvasOperation.SaveLayer);
+
+			Assert.Equal(1, rect.FeatureCounts[SKPaintFeatures.Antialias]);
+			Assert.Equal(1, rect.FeatureCounts[SKPaintFeatures.Shader]);
+			Assert.False(rect.FeatureCounts.ContainsKey(SKPaintFeatures.ImageFilter));
+			Assert.Equal(1, layer.FeatureCounts[SKPaintFeatures.SaveLayer]);
+		}
+
+		[SkippableFact]
+		public void PaintFeatureQueriesDoNotLeakReferences()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var shader = SKShader.CreateColor(SKColors.Blue);
+			using var paint = new SKPaint { Shader = shader };
+
+			var refs = shader.GetReferenceCount();
+
+			profiling.DrawRect(0, 0, 5, 5, paint);
+
+			Assert.Equal(refs, shader.GetReferenceCount());
+		}
+
+		[SkippableFact]
+		public void SamplingStillCountsAllOperations()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas) { SampleInterval = 4 };
+			using var paint = new SKPaint();
+
+			for (var i = 0; i < 100; i++)
+				profiling.DrawRect(0, 0, 5, 5, paint);
+
+			var rect = Assert.Single(profiling.GetReport().Operations);
+
+			Assert.Equal(100, rect.Count);
+			Assert.Equal(25, rect.SampledCount);
+		}
+
+		[SkippableFact]
+		public void CallersAreCaptured()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas) { CaptureCallers = true };
+			using var paint = new SKPaint();
+
+			profiling.DrawRect(0, 0, 5, 5, paint);
+
+			var caller = Assert.Single(profiling.GetReport().Callers);
+			Assert.Contains(nameof(CallersAreCaptured), caller.Caller);
+		}
+
+		[SkippableFact]
+		public void ChromeTraceContainsTheOperations()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas) { RecordTrace = true };
+			using var paint = new SKPaint();
+
+			profiling.DrawRect(0, 0, 5, 5, paint);
+			profiling.DrawOval(SKRect.Create(5, 5), paint);
+
+			using var stream = new MemoryStream();
+			profiling.WriteChromeTrace(stream);
+			var json = Encoding.UTF8.GetString(stream.ToArray());
+
+			Assert.StartsWith("{", json);
+			Assert.Contains("\"name\":\"DrawRect\"", json);
+			Assert.Contains("\"name\":\"DrawOval\"", json);
+		}
+
+		[SkippableFact]
+		public void ResetClearsTheResults()
+		{
+			using var bitmap = new SKBitmap(new SKImageInfo(10, 10));
+			using var canvas = new SKCanvas(bitmap);
+			using var profiling = new SKProfilingCanvas(canvas);
+			using var paint = new SKPaint();
+
+			profiling.DrawRect(0, 0, 5, 5, paint);
+			profiling.Reset();
+
+			Assert.Empty(profiling.GetReport().Operations);
+		}
+	}
+}
@@ -0,0 +1,176 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKProgressiveDecoderTest : SKTest
+	{
+		[SkippableTheory]
+		[InlineData("baboon.png")]
+		[InlineData("color-wheel.png")]
+		[InlineData("baboon.jpg")]
+		[InlineData("animated-heart.gif")]
+		[InlineData("baboon.png", SKEncodedImageFormat.Webp)]
+		public async Task DecodesTheSamePixelsAsDecode(string image, SKEncodedImageFormat? encodeAs = null)
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, image));
+			if (encodeAs is SKEncodedImageFormat format)
+			{
+				using var original = SKBitmap.Decode(bytes);
+				using var encoded = original.Encode(format, 100);
+				bytes = encoded.ToArray();
+			}
+
+			using var expected = SKBitmap.Decode(bytes);
+
+			using var stream = new ThrottledStream(bytes, 4096);
+			using var decoder = new SKProgressiveDecoder(stream);
+
+			var result = await decoder.DecodeAsync();
+
+			Assert.Equal(SKCodecResult.Success, result);
+			Assert.Equal(expected.Info, decoder.Info);
+			Assert.Equal(expected.Height, decoder.DecodedRows);
+			Assert.Equal(expected.Pixels, decoder.Bitmap.Pixels);
+		}
+
+		[SkippableFact]
+		public async Task RowsAreReportedBeforeTheStreamEnds()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.png"));
+			using var stream = new ThrottledStream(bytes, 4096);
+			using var decoder = new SKProgressiveDecoder(stream);
+
+			var reports = new List<SKRectI>();
+			var bytesAtFirstReport = -1;
+			var progress = new SynchronousProgress<SKRectI>(bounds =>
+			{
+				if (reports.Count == 0)
+					bytesAtFirstReport = stream.BytesRead;
+				reports.Add(bounds);
+			});
+
+			var result = await decoder.DecodeAsync(progress);
+
+			Assert.Equal(SKCodecResult.Success, result);
+			Assert.True(decoder.IsIncremental);
+			Assert.True(reports.Count > 1);
+			Assert.InRange(bytesAtFirstReport, 1, bytes.Length / 2);
+
+			// the rows only ever grow from the top
+			for (var i = 1; i < reports.Count; i++)
+			{
+				Assert.Equal(0, reports[i].Top);
+				Assert.True(reports[i].Bottom > reports[i - 1].Bottom);
+			}
+			Assert.Equal(decoder.Info.Rect, reports[reports.Count - 1]);
+		}
+
+		[SkippableFact]
+		public async Task FormatsWithoutIncrementalDecodingAreReportedOnce()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.jpg"));
+			using var stream = new ThrottledStream(bytes, 4096);
+			using var decoder = new SKProgressiveDecoder(stream);
+
+			var reports = new List<SKRectI>();
+			var result = await decoder.DecodeAsync(new SynchronousProgress<SKRectI>(reports.Add));
+
+			Assert.Equal(SKCodecResult.Success, result);
+			Assert.False(decoder.IsIncremental);
+			Assert.Equal(new[] { decoder.Info.Rect }, reports);
+		}
+
+		[SkippableFact]
+		public async Task TruncatedStreamKeepsThePartialImage()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.png"));
+			Array.Resize(ref bytes, bytes.Length / 2);
+
+			using var stream = new ThrottledStream(bytes, 4096);
+			using var decoder = new SKProgressiveDecoder(stream);
+
+			var result = await decoder.DecodeAsync();
+
+			Assert.Equal(SKCodecResult.IncompleteInput, result);
+			Assert.NotNull(decoder.Bitmap);
+			Assert.InRange(decoder.DecodedRows, 1, decoder.Info.Height - 1);
+		}
+
+		[SkippableFact]
+		public async Task InvalidDataIsNotDecoded()
+		{
+			var bytes = new byte[10000];
+			new Random(1).NextBytes(bytes);
+
+			using var stream = new ThrottledStream(bytes, 4096);
+			using var decoder = new SKProgressiveDecoder(stream);
+
+			var result = await decoder.DecodeAsync();
+
+			Assert.NotEqual(SKCodecResult.Success, result);
+			Assert.Null(decoder.Bitmap);
+		}
+
+		[SkippableFact]
+		public async Task CancellationStopsTheDecode()
+		{
+			var bytes = File.ReadAllBytes(Path.Combine(PathToImages, "baboon.png"));
+			using var stream = new ThrottledStream(bytes, 4096);
+			using var decoder = new SKProgressiveDecoder(stream);
+			using var cts = new CancellationTokenSource();
+
+			var progress = new SynchronousProgress<SKRectI>(_ => cts.Cancel());
+
+			await Assert.ThrowsAnyAsync<OperationCanceledException>(() => decoder.DecodeAsync(progress, cts.Token));
+			Assert.True(stream.BytesRead < bytes.Length);
+		}
+
+		[SkippableFact]
+		public async Task DetachedBitmapIsNotDisposedWithTheDecoder()
+		{
+			var path = Path.Combine(PathToImages, "color-wheel.png");
+
+			SKBitmap bitmap;
+			using (var decoder = new SKProgressiveDecoder(new ThrottledStream(File.ReadAllBytes(path), 4096)))
+			{
+				await decoder.DecodeAsync();
+				bitmap = decoder.DetachBitmap();
+				Assert.Null(decoder.Bitmap);
+			}
+
+			using (bitmap)
+			using (var expected = SKBitmap.Decode(path))
+			{
+				Assert.Equal(expected.Pixels, bitmap.Pixels);
+			}
+		}
+
+		[SkippableFact]
+		public async Task DecoderCanOnlyBeStartedOnce()
+		{
+			var path = Path.Combine(PathToImages, "color-wheel.png");
+			using var decoder = new SKProgressiveDecoder(new ThrottledStream(File.ReadAllBytes(path), 4096));
+
+			await decoder.DecodeAsync();
+
+			Assert.Throws<InvalidOperationException>(() => { _ = decoder.DecodeAsync(); });
+		}
+
+		private class SynchronousProgress<T> : IProgress<T>
+		{
+			private readonly Action<T> report;
+
+			public SynchronousProgress(Action<T> report)
+			{
+				this.report = report;
+			}
+
+			public void Report(T value) => report(value);
+		}
+	}
+}
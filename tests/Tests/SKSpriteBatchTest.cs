@@ -0,0 +1,223 @@
+﻿using System;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKSpriteBatchTest : SKTest
+	{
+		private static readonly SKRect RedSprite = SKRect.Create(0, 0, 16, 16);
+		private static readonly SKRect BlueSprite = SKRect.Create(16, 0, 16, 16);
+		private static readonly SKRect WhiteSprite = SKRect.Create(32, 0, 16, 16);
+
+		[SkippableFact]
+		public void BatchIsTheSameAsDrawImage()
+		{
+			using var atlas = CreateAtlas();
+			var info = new SKImageInfo(100, 100);
+
+			using var expected = new SKBitmap(info);
+			using (var canvas = new SKCanvas(expected))
+			{
+				canvas.Clear(SKColors.Transparent);
+				canvas.DrawImage(atlas, RedSprite, SKRect.Create(10, 10, 16, 16));
+				canvas.DrawImage(atlas, BlueSprite, SKRect.Create(50, 20, 16, 16));
+				canvas.DrawImage(atlas, RedSprite, SKRect.Create(30, 60, 16, 16));
+			}
+
+			using var actual = new SKBitmap(info);
+			using (var canvas = new SKCanvas(actual))
+			using (var batch = new SKSpriteBatch(canvas))
+			{
+				canvas.Clear(SKColors.Transparent);
+				batch.Draw(atlas, RedSprite, 10, 10);
+				batch.Draw(atlas, BlueSprite, 50, 20);
+				batch.Draw(atlas, RedSprite, 30, 60);
+				batch.Flush();
+
+				Assert.Equal(1, batch.DrawCallCount);
+				Assert.Equal(3, batch.SpriteCount);
+				Assert.Equal(0, batch.PendingSpriteCount);
+			}
+
+			Assert.Equal(expected.Pixels, actual.Pixels);
+		}
+
+		[SkippableFact]
+		public void NothingIsDrawnUntilFlushed()
+		{
+			using var atlas = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas);
+
+			canvas.Clear(SKColors.Transparent);
+			batch.Draw(atlas, RedSprite, 10, 10);
+
+			Assert.Equal(1, batch.PendingSpriteCount);
+			Assert.Equal(SKColors.Transparent, bitmap.GetPixel(15, 15));
+
+			batch.Flush();
+
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(15, 15));
+		}
+
+		[SkippableFact]
+		public void ChangingTheAtlasStartsANewCall()
+		{
+			using var atlas1 = CreateAtlas();
+			using var atlas2 = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas);
+
+			for (var i = 0; i < 4; i++)
+			{
+				batch.Draw(atlas1, RedSprite, i * 10, 0);
+				batch.Draw(atlas2, BlueSprite, i * 10, 50);
+			}
+			batch.Flush();
+
+			Assert.Equal(8, batch.DrawCallCount);
+		}
+
+		[SkippableFact]
+		public void UnorderedBatchesAreGroupedByAtlas()
+		{
+			using var atlas1 = CreateAtlas();
+			using var atlas2 = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas) { PreserveOrder = false };
+
+			for (var i = 0; i < 4; i++)
+			{
+				batch.Draw(atlas1, RedSprite, i * 10, 0);
+				batch.Draw(atlas2, BlueSprite, i * 10, 50);
+			}
+			batch.Flush();
+
+			Assert.Equal(2, batch.DrawCallCount);
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(35, 5));
+			Assert.Equal(SKColors.Blue, bitmap.GetPixel(35, 55));
+		}
+
+		[SkippableFact]
+		public void SpritesCanBeTinted()
+		{
+			using var atlas = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas);
+
+			canvas.Clear(SKColors.Transparent);
+			batch.Draw(atlas, WhiteSprite, 0, 0);
+			batch.Draw(atlas, WhiteSprite, 50, 50, SKColors.Lime);
+			batch.Flush();
+
+			Assert.Equal(1, batch.DrawCallCount);
+			Assert.Equal(SKColors.White, bitmap.GetPixel(5, 5));
+			Assert.Equal(SKColors.Lime, bitmap.GetPixel(55, 55));
+		}
+
+		[SkippableFact]
+		public void SpritesOutsideTheClipAreCulled()
+		{
+			using var atlas = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas) { CullToClip = true };
+
+			canvas.Clear(SKColors.Transparent);
+			batch.Draw(atlas, RedSprite, 10, 10);
+			batch.Draw(atlas, RedSprite, 200, 10);
+			batch.Draw(atlas, RedSprite, -50, -50);
+			batch.Draw(atlas, RedSprite, 95, 95);
+			batch.Flush();
+
+			Assert.Equal(4, batch.SpriteCount);
+			Assert.Equal(2, batch.CulledSpriteCount);
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(15, 15));
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(97, 97));
+		}
+
+		[SkippableFact]
+		public void RotatedSpritesAreDrawnAroundTheAnchor()
+		{
+			using var atlas = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas);
+
+			canvas.Clear(SKColors.Transparent);
+			batch.Draw(atlas, RedSprite, new SKPoint(50, 50), 45, 2, new SKPoint(8, 8), SKColors.White);
+			batch.Flush();
+
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(50, 50));
+			Assert.Equal(SKColors.Red, bitmap.GetPixel(50, 30));
+			Assert.Equal(SKColors.Transparent, bitmap.GetPixel(30, 30));
+		}
+
+		[SkippableFact]
+		public void BoundsOfRotatedSpriteAreCorrect()
+		{
+			var transform = SKRotationScaleMatrix.CreateDegrees(1, 90, 50, 50, 0, 0);
+
+			var bounds = SKSpriteBatch.GetBounds(SKRect.Create(0, 0, 20, 10), transform);
+
+			Assert.Equal(40, bounds.Left, 3);
+			Assert.Equal(50, bounds.Top, 3);
+			Assert.Equal(50, bounds.Right, 3);
+			Assert.Equal(70, bounds.Bottom, 3);
+		}
+
+		[SkippableFact]
+		public void BuffersAreReusedAcrossFlushes()
+		{
+			using var atlas = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			using var batch = new SKSpriteBatch(canvas);
+
+			for (var frame = 0; frame < 3; frame++)
+			{
+				for (var i = 0; i < 1000; i++)
+					batch.Draw(atlas, RedSprite, i % 100, i / 10);
+				batch.Flush();
+			}
+
+			Assert.Equal(3, batch.DrawCallCount);
+			Assert.Equal(3000, batch.SpriteCount);
+		}
+
+		[SkippableFact]
+		public void DisposedBatchThrows()
+		{
+			using var atlas = CreateAtlas();
+			using var bitmap = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bitmap);
+			var batch = new SKSpriteBatch(canvas);
+
+			batch.Draw(atlas, RedSprite, 0, 0);
+			batch.Dispose();
+
+			Assert.Throws<ObjectDisposedException>(() => batch.Draw(atlas, RedSprite, 0, 0));
+		}
+
+		private static SKImage CreateAtlas()
+		{
+			using var surface = SKSurface.Create(new SKImageInfo(48, 16));
+			var canvas = surface.Canvas;
+			canvas.Clear(SKColors.Transparent);
+
+			using var paint = new SKPaint();
+			paint.Color = SKColors.Red;
+			canvas.DrawRect(RedSprite, paint);
+			paint.Color = SKColors.Blue;
+			canvas.DrawRect(BlueSprite, paint);
+			paint.Color = SKColors.White;
+			canvas.DrawRect(WhiteSprite, paint);
+
+			return surface.Snapshot();
+		}
+	}
+}
@@ -0,0 +1,67 @@
+﻿using System;
+using System.Linq;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKStartupTraceTest : SKTest
+	{
+		[SkippableFact]
+		public void MeasureRecordsStepsWhenEnabled()
+		{
+			var wasEnabled = SKStartupTrace.IsEnabled;
+			try
+			{
+				SKStartupTrace.IsEnabled = true;
+
+				var result = SKStartupTrace.Measure("TestStep", () => 42);
+
+				Assert.Equal(42, result);
+				Assert.Contains("TestStep", SKStartupTrace.GetSteps().Select(s => s.Name));
+			}
+			finally
+			{
+				SKStartupTrace.IsEnabled = wasEnabled;
+				SKStartupTrace.Clear();
+			}
+		}
+
+		[SkippableFact]
+		public void MeasureDoesNotRecordStepsWhenDisabled()
+		{
+			var wasEnabled = SKStartupTrace.IsEnabled;
+			try
+			{
+				SKStartupTrace.IsEnabled = false;
+
+				var name = Guid.NewGuid().ToString();
+				SKStartupTrace.Measure(name, () => { });
+
+				Assert.DoesNotContain(name, SKStartupTrace.GetSteps().Select(s => s.Name));
+			}
+			finally
+			{
+				SKStartupTrace.IsEnabled = wasEnabled;
+			}
+		}
+
+		[SkippableFact]
+		public void WrappingTheSrgbHandleFirstStillGivesTheStaticInstance()
+		{
+			// wrap the handle before asking for the static instance, so that
+			// the lazy instance is created from inside GetObject; the extra
+			// reference is released when the static instance is found
+			var wrapped = SKColorSpace.GetObject(SkiaApi.sk_colorspace_new_srgb());
+
+			Assert.Same(SKColorSpace.CreateSrgb(), wrapped);
+		}
+
+		[SkippableFact]
+		public void WrappingTheEmptyDataHandleFirstStillGivesTheStaticInstance()
+		{
+			var wrapped = SKData.GetObject(SkiaApi.sk_data_new_empty());
+
+			Assert.Same(SKData.Empty, wrapped);
+		}
+	}
+}
@@ -0,0 +1,184 @@
+﻿using System;
+using Xunit;
+
+namespace SkiaSharp.Tests
+{
+	public class SKTextBlobCacheTest : SKTest
+	{
+		[SkippableTheory]
+		[InlineData(SKTextAlign.Left)]
+		[InlineData(SKTextAlign.Center)]
+		[InlineData(SKTextAlign.Right)]
+		public void CachedDrawTextIsTheSameAsDrawText(SKTextAlign align)
+		{
+			var info = new SKImageInfo(300, 300);
+
+			using var font = new SKFont(SKTypeface.Default, 40);
+			using var paint = new SKPaint { TextAlign = align, IsAntialias = true };
+			using var cache = new SKTextBlobCache();
+
+			byte[] expected;
+			using (var bmp = new SKBitmap(info))
+			using (var canvas = new SKCanvas(bmp))
+			{
+				canvas.Clear(SKColors.White);
+				canvas.DrawText("SkiaSharp", 150, 175, font, paint);
+
+				expected = bmp.Bytes;
+			}
+
+			for (var i = 0; i < 2; i++)
+			{
+				using var bmp = new SKBitmap(info);
+				using var canvas = new SKCanvas(bmp);
+				canvas.TextBlobCache = cache;
+
+				canvas.Clear(SKColors.White);
+				canvas.DrawText("SkiaSharp", 150, 175, font, paint);
+
+				Assert.Equal(expected, bmp.Bytes);
+			}
+
+			Assert.Equal(1, cache.MissCount);
+			Assert.Equal(1, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void DifferentFontsAreCachedSeparately()
+		{
+			using var bmp = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bmp);
+			using var cache = new SKTextBlobCache();
+			using var paint = new SKPaint();
+			using var font = new SKFont();
+			canvas.TextBlobCache = cache;
+
+			canvas.DrawText("Label", 10, 50, font, paint);
+			canvas.DrawText("Label", 10, 50, font, paint);
+
+			font.Size = 20;
+			canvas.DrawText("Label", 10, 50, font, paint);
+
+			font.Edging = SKFontEdging.Alias;
+			canvas.DrawText("Label", 10, 50, font, paint);
+
+			Assert.Equal(3, cache.Count);
+			Assert.Equal(3, cache.MissCount);
+			Assert.Equal(1, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void ResettingThePaintInvalidatesItsFont()
+		{
+			using var bmp = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bmp);
+			using var cache = new SKTextBlobCache();
+			using var paint = new SKPaint { TextSize = 30 };
+			canvas.TextBlobCache = cache;
+
+			canvas.DrawText("Label", 10, 50, paint);
+			canvas.DrawText("Label", 10, 50, paint);
+
+			paint.Reset();
+			canvas.DrawText("Label", 10, 50, paint);
+
+			Assert.Equal(2, cache.MissCount);
+			Assert.Equal(1, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void LeastRecentlyUsedBlobsAreEvicted()
+		{
+			using var bmp = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bmp);
+			using var cache = new SKTextBlobCache(2);
+			using var paint = new SKPaint();
+			using var font = new SKFont();
+			canvas.TextBlobCache = cache;
+
+			canvas.DrawText("A", 10, 50, font, paint);
+			canvas.DrawText("B", 10, 50, font, paint);
+			canvas.DrawText("A", 10, 50, font, paint);
+			canvas.DrawText("C", 10, 50, font, paint);
+
+			Assert.Equal(2, cache.Count);
+			Assert.Equal(1, cache.EvictionCount);
+
+			// "B" was the least recently used
+			canvas.DrawText("A", 10, 50, font, paint);
+			canvas.DrawText("B", 10, 50, font, paint);
+
+			Assert.Equal(2, cache.HitCount);
+			Assert.Equal(4, cache.MissCount);
+		}
+
+		[SkippableFact]
+		public void ReducingTheCapacityEvictsBlobs()
+		{
+			using var bmp = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bmp);
+			using var cache = new SKTextBlobCache();
+			using var paint = new SKPaint();
+			using var font = new SKFont();
+			canvas.TextBlobCache = cache;
+
+			for (var i = 0; i < 10; i++)
+				canvas.DrawText(i.ToString(), 10, 50, font, paint);
+
+			cache.Capacity = 4;
+
+			Assert.Equal(4, cache.Count);
+			Assert.Equal(6, cache.EvictionCount);
+		}
+
+		[SkippableFact]
+		public void CanInvalidateEntries()
+		{
+			using var bmp = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bmp);
+			using var cache = new SKTextBlobCache();
+			using var paint = new SKPaint();
+			using var font = new SKFont();
+			canvas.TextBlobCache = cache;
+
+			canvas.DrawText("A", 10, 50, font, paint);
+			font.Size = 30;
+			canvas.DrawText("A", 10, 50, font, paint);
+			canvas.DrawText("B", 10, 50, font, paint);
+
+			Assert.Equal(2, cache.Remove("A"));
+			Assert.Equal(1, cache.Count);
+
+			cache.Clear();
+			Assert.Equal(0, cache.Count);
+
+			canvas.DrawText("B", 10, 50, font, paint);
+			Assert.Equal(0, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void EmptyTextIsNotDrawn()
+		{
+			using var bmp = new SKBitmap(new SKImageInfo(100, 100));
+			using var canvas = new SKCanvas(bmp);
+			using var cache = new SKTextBlobCache();
+			using var paint = new SKPaint();
+			using var font = new SKFont();
+			canvas.TextBlobCache = cache;
+
+			canvas.DrawText("", 10, 50, font, paint);
+			canvas.DrawText("", 10, 50, font, paint);
+
+			Assert.Equal(1, cache.HitCount);
+		}
+
+		[SkippableFact]
+		public void InvalidCapacityThrows()
+		{
+			Assert.Throws<ArgumentOutOfRangeException>(() => new SKTextBlobCache(0));
+
+			using var cache = new SKTextBlobCache();
+			Assert.Throws<ArgumentOutOfRangeException>(() => cache.Capacity = -1);
+		}
+	}
+}
@@ -0,0 +1,94 @@
+﻿using System;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace SkiaSharp.Tests
+{
+	// a non-seekable stream that only returns a few bytes at a time, like a
+	// slow download
+	public class ThrottledStream : Stream
+	{
+		private readonly byte[] data;
+		private readonly int chunkSize;
+		private readonly TimeSpan delay;
+		private int position;
+
+		public ThrottledStream(byte[] data, int chunkSize)
+			: this(data, chunkSize, TimeSpan.Zero)
+		{
+		}
+
+		public ThrottledStream(byte[] data, int chunkSize, TimeSpan delay)
+		{
+			this.data = data;
+			this.chunkSize = chunkSize;
+			this.delay = delay;
+		}
+
+		public int BytesRead => Volatile.Read(ref position);
+
+		public int ReadCount { get; private set; }
+
+		public override bool CanRead => true;
+
+		public override bool CanSeek => false;
+
+		public override bool CanWrite => false;
+
+		public override long Length => throw new NotSupportedException();
+
+		public override long Position
+		{
+			get { return position; }
+			set { throw new NotSupportedException(); }
+		}
+
+		public override void Flush()
+		{
+		}
+
+		public override int Read(byte[] buffer, int offset, int count)
+		{
+			if (delay > TimeSpan.Zero)
+				Thread.Sleep(delay);
+			return ReadChunk(buffer, offset, count);
+		}
+
+		public override async Task<int> ReadAsync(byte[] buffer, int offset, int count, CancellationToken cancellationToken)
+		{
+			if (delay > TimeSpan.Zero)
+				await Task.Delay(delay, cancellationToken);
+			else
+				await Task.Yield();
+
+			cancellationToken.ThrowIfCancellationRequested();
+			return ReadChunk(buffer, offset, count);
+		}
+
+		private int ReadChunk(byte[] buffer, int offset, int count)
+		{
+			ReadCount++;
+
+			var read = Math.Min(Math.Min(count, chunkSize), data.Length - position);
+			Buffer.BlockCopy(data, position, buffer, offset, read);
+			Volatile.Write(ref position, position + read);
+			return read;
+		}
+
+		public override long Seek(long offset, SeekOrigin origin)
+		{
+			throw new NotSupportedException();
+		}
+
+		public override void SetLength(long value)
+		{
+			throw new NotSupportedException();
+		}
+
+		public override void Write(byte[] buffer, int offset, int count)
+		{
+			throw new NotSupportedException();
+		}
+	}
+}